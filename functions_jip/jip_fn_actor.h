@@ -141,6 +141,7 @@ DEFINE_COMMAND_PLUGIN(GetActorVelocityAlt, 1, kParams_ThreeScriptVars_OneOptiona
 DEFINE_COMMAND_PLUGIN(GetExcludedCombatActions, 1, nullptr);
 DEFINE_COMMAND_PLUGIN(SetExcludedCombatActions, 1, kParams_OneInt);
 DEFINE_COMMAND_PLUGIN(GetAllPerks, 1, kParams_TwoOptionalInts);
+DEFINE_COMMAND_PLUGIN(GetActorsInRadius, 0, kParams_OneFloat_ThreeOptionalFloats_OneOptionalInt);
 
 bool Cmd_GetActorTemplate_Execute(COMMAND_ARGS)
 {
@@ -439,6 +440,137 @@ bool Cmd_GetActorsByProcessingLevel_Execute(COMMAND_ARGS)
 	return true;
 }
 
+#define ACTORS_GRID_CELL_SIZE 1024.0F
+#define ACTORS_GRID_MAX_DIM 0x40
+
+//	Uniform 2D grid over the high-process actors, snapshotted on the first radius query of each frame.
+struct ActorsGrid
+{
+	struct Entry
+	{
+		Actor		*actor;
+		NiVector3	pos;
+
+		Entry() {}
+		Entry(Actor *_actor) : actor(_actor), pos(_actor->position) {}
+	};
+
+	bool			isValid;
+	float			originX, originY, invCellSize;
+	UInt32			dimX, dimY;
+	Vector<Entry>	buffer;
+	Vector<Entry>	entries;	//	Grouped by cell
+	Vector<UInt32>	cellStarts;	//	dimX * dimY + 1 offsets into entries
+
+	UInt32 GetCoord(float pos, float origin, UInt32 dim) const
+	{
+		int coord = ifloor((pos - origin) * invCellSize);
+		return (coord <= 0) ? 0 : GetMin((UInt32)coord, dim - 1);
+	}
+
+	UInt32 GetCell(const NiVector3 &pos) const
+	{
+		return GetCoord(pos.x, originX, dimX) + GetCoord(pos.y, originY, dimY) * dimX;
+	}
+
+	void Build()
+	{
+		isValid = true;
+		buffer.Clear();
+		entries.Clear();
+		cellStarts.Clear();
+		ProcessManager *procMngr = ProcessManager::Get();
+		MobileObject **objArray = procMngr->objects.data, **arrEnd = objArray;
+		objArray += procMngr->beginOffsets[0];
+		arrEnd += procMngr->endOffsets[0];
+		float minX = 0, minY = 0, maxX = 0, maxY = 0;
+		for (; objArray != arrEnd; objArray++)
+		{
+			Actor *actor = (Actor*)*objArray;
+			if (!actor || NOT_ACTOR(actor))
+				continue;
+			NiVector3 &pos = buffer.Append(actor)->pos;
+			if (buffer.Size() == 1)
+			{
+				minX = maxX = pos.x;
+				minY = maxY = pos.y;
+				continue;
+			}
+			minX = GetMin(minX, pos.x);
+			maxX = GetMax(maxX, pos.x);
+			minY = GetMin(minY, pos.y);
+			maxY = GetMax(maxY, pos.y);
+		}
+		if (buffer.Empty())
+			return;
+		originX = minX;
+		originY = minY;
+		float cellSize = GetMax(ACTORS_GRID_CELL_SIZE, GetMax(maxX - minX, maxY - minY) / ACTORS_GRID_MAX_DIM);
+		invCellSize = 1.0F / cellSize;
+		dimX = GetMin((UInt32)((maxX - minX) * invCellSize) + 1, ACTORS_GRID_MAX_DIM);
+		dimY = GetMin((UInt32)((maxY - minY) * invCellSize) + 1, ACTORS_GRID_MAX_DIM);
+		//	Counting sort of the snapshot into per-cell runs.
+		cellStarts.Resize(dimX * dimY + 1);
+		for (auto iter = buffer.Begin(); iter; ++iter)
+			cellStarts[GetCell(iter().pos) + 1]++;
+		for (UInt32 index = 1; index < cellStarts.Size(); index++)
+			cellStarts[index] += cellStarts[index - 1];
+		entries.Resize(buffer.Size());
+		for (auto iter = buffer.Begin(); iter; ++iter)
+			entries[cellStarts[GetCell(iter().pos)]++] = iter();
+		//	The scatter advanced each start to the next cell's; shift them back.
+		for (UInt32 index = cellStarts.Size() - 1; index; index--)
+			cellStarts[index] = cellStarts[index - 1];
+		cellStarts[0] = 0;
+	}
+
+	void Query(const NiVector3 &centre, float radius, TESObjectREFR *exclude, bool skipDead, TempElements *results)
+	{
+		if (!isValid) Build();
+		if (entries.Empty())
+			return;
+		UInt32 minCX = GetCoord(centre.x - radius, originX, dimX), maxCX = GetCoord(centre.x + radius, originX, dimX),
+			minCY = GetCoord(centre.y - radius, originY, dimY), maxCY = GetCoord(centre.y + radius, originY, dimY);
+		float radiusSq = radius * radius;
+		for (UInt32 cellY = minCY; cellY <= maxCY; cellY++)
+		{
+			UInt32 rowIdx = cellY * dimX;
+			for (UInt32 index = cellStarts[rowIdx + minCX], endIdx = cellStarts[rowIdx + maxCX + 1]; index < endIdx; index++)
+			{
+				Entry &entry = entries[index];
+				if (entry.actor == exclude)
+					continue;
+				float dX = entry.pos.x - centre.x, dY = entry.pos.y - centre.y, dZ = entry.pos.z - centre.z;
+				if ((dX * dX + dY * dY + dZ * dZ) > radiusSq)
+					continue;
+				if (!skipDead || !entry.actor->GetDead())
+					results->Append(entry.actor);
+			}
+		}
+	}
+};
+TempObject<ActorsGrid> s_actorsGrid;
+PrimitiveCS s_actorsGridCS;
+
+bool Cmd_GetActorsInRadius_Execute(COMMAND_ARGS)
+{
+	float radius;
+	NiVector3 centre;
+	UInt32 skipDead = 0;
+	if (!ExtractArgsEx(EXTRACT_ARGS_EX, &radius, &centre.x, &centre.y, &centre.z, &skipDead) || (radius <= 0))
+		return true;
+	if (thisObj)
+		centre = thisObj->position;
+	TempElements *tmpElements = GetTempElements();
+	{
+		ScopedPrimitiveCS cs(&s_actorsGridCS);
+		s_actorsGrid->Query(centre, radius, thisObj, skipDead != 0, tmpElements);
+	}
+	if (!tmpElements->Empty())
+		*result = (int)CreateArray(tmpElements->Data(), tmpElements->Size(), scriptObj);
+	return true;
+}
+
 bool Cmd_GetActorLightAmount_Execute(COMMAND_ARGS)
 {
 	if (Actor *actor = (Actor*)thisObj; IS_ACTOR(actor) && actor->baseProcess && !actor->baseProcess->processLevel)
@@ -2049,20 +2181,57 @@ bool Cmd_GetBodyPartVATSTarget_Execute(COMMAND_ARGS)
 	return true;
 }
 
-__declspec(noinline) bool __fastcall GetInFactionList(Actor *actor, BGSListForm *facList)
+#define ACTOR_FACTION_SETS_MAX 0x400
+
+//	Returns the cached faction set of the actor, rebuilding it if the actor's base or faction changes no longer
+//	match. Must be called with s_actorFactionSetsCS held.
+TempFormList* __fastcall GetActorFactionSet(Actor *actor)
 {
-	TempFormList *tmpFormLst = GetTempFormList();
-	if (GetFactionList(actor, nullptr, tmpFormLst))
+	tList<FactionListData>::Node *changesHead = nullptr;
+	if (auto xFactionChanges = GetExtraType(&actor->extraDataList, ExtraFactionChanges); xFactionChanges && xFactionChanges->data)
+		changesHead = xFactionChanges->data->Head();
+	if (s_actorFactionSets->Size() >= ACTOR_FACTION_SETS_MAX)
+		s_actorFactionSets->Clear();
+	ActorFactionSet *factionSet;
+	if (!s_actorFactionSets->Insert(actor->refID, &factionSet) && (factionSet->actorBase == actor->baseForm))
 	{
-		auto listIter = facList->list.Head();
+		UInt32 numChanges = 0;
+		bool isValid = true;
+		if (auto traverse = changesHead)
+			do
+			{
+				if (FactionListData *data = traverse->data)
+					if ((numChanges >= factionSet->changes.Size()) || (factionSet->changes[numChanges++] != (UInt32(data->faction) | (data->rank < 0))))
+					{
+						isValid = false;
+						break;
+					}
+			}
+			while (traverse = traverse->next);
+		if (isValid && (numChanges == factionSet->changes.Size()))
+			return &factionSet->factions;
+	}
+	factionSet->actorBase = (TESActorBase*)actor->baseForm;
+	factionSet->changes.Clear();
+	if (auto traverse = changesHead)
 		do
 		{
-			if (tmpFormLst->HasKey(listIter->data))
-				return true;
+			if (FactionListData *data = traverse->data)
+				factionSet->changes.Append(UInt32(data->faction) | (data->rank < 0));
 		}
-		while (listIter = listIter->next);
-	}
-	return false;
+		while (traverse = traverse->next);
+	factionSet->factions.Clear();
+	GetFactionList(actor, nullptr, &factionSet->factions);
+	return &factionSet->factions;
+}
+
+__declspec(noinline) bool __fastcall GetInFactionList(Actor *actor, BGSListForm *facList)
+{
+	if (!actor || NOT_ACTOR(actor))
+		return false;
+	ScopedPrimitiveCS cs(&s_actorFactionSetsCS);
+	TempFormList *factions = GetActorFactionSet(actor);
+	return !factions->Empty() && FormListContainsAny(facList, factions);
 }
 
 bool Cmd_GetInFactionList_Execute(COMMAND_ARGS)
@@ -14,8 +14,13 @@ DEFINE_COMMAND_ALT_PLUGIN(AuxiliaryVariableSetFromArray, AuxVarSetFromArr, 0, kP
 DEFINE_COMMAND_ALT_PLUGIN(AuxiliaryVariableErase, AuxVarErase, 0, kParams_OneString_OneOptionalInt_OneOptionalForm);
 DEFINE_COMMAND_ALT_PLUGIN(AuxiliaryVariableEraseAll, AuxVarEraseAll, 0, kParams_OneInt_OneOptionalForm);
 DEFINE_CMD_COND_ONLY(AuxVarGetFltCond, kParams_OneQuest_OneInt);
+DEFINE_COMMAND_ALT_PLUGIN(AuxiliaryVariableGetMulti, AuxVarGetMulti, 0, kParams_OneInt_OneOptionalInt_OneOptionalForm);
+DEFINE_COMMAND_ALT_PLUGIN(AuxiliaryVariableSetMulti, AuxVarSetMulti, 0, kParams_OneInt_OneOptionalInt_OneOptionalForm);
+DEFINE_COMMAND_ALT_PLUGIN(AuxiliaryVariableGetForOwners, AuxVarGetForOwners, 0, kParams_OneString_OneInt_OneOptionalInt);
+DEFINE_COMMAND_ALT_PLUGIN(AuxiliaryVariableSetForOwners, AuxVarSetForOwners, 0, kParams_OneString_TwoInts_OneOptionalInt);
 
-#define AUX_VAR_CS	ScopedPrimitiveCS cs(&s_auxVarCS);
+#define AUX_VAR_CS	ScopedWriteRWCS cs(&s_auxVarCS);
+#define AUX_VAR_READ_CS	ScopedReadRWCS cs(&s_auxVarCS);
 
 __declspec(noinline) AuxVarValsArr* __fastcall AuxVarInfo::GetArray(bool addArr)
 {
@@ -27,21 +32,64 @@ __declspec(noinline) AuxVarValsArr* __fastcall AuxVarInfo::GetArray(bool addArr)
 	return nullptr;
 }
 
+__declspec(noinline) AuxVariableValue* __fastcall AuxVarValueAt(AuxVarValsArr *valsArr, SInt32 idx, bool addVal)
+{
+	SInt32 size = valsArr->Size();
+	if (addVal && ((idx < 0) || (idx == size)))
+		return valsArr->Append();
+	if (size && (idx < size))
+	{
+		if (idx < 0)
+			idx = size - 1;
+		return &(*valsArr)[idx];
+	}
+	return nullptr;
+}
+
 __declspec(noinline) AuxVariableValue* __fastcall AuxVarInfo::GetValue(SInt32 idx, bool addVal)
 {
 	if (AuxVarValsArr *valsArr = GetArray(addVal && (idx <= 0)))
+		return AuxVarValueAt(valsArr, idx, addVal);
+	return nullptr;
+}
+
+//	Used by the batch commands: resolves the owner's variables map once per (temp/public) combination
+//	of the variable names, instead of once per variable.
+class AuxVarBatchOwner
+{
+	UInt32			ownerID;
+	UInt32			scriptModIdx;
+	bool			addVars;
+	UInt8			resolved;
+	AuxVarVarsMap	*varsMaps[4];
+
+public:
+	AuxVarBatchOwner(UInt32 _ownerID, Script *scriptObj, bool _addVars) :
+		ownerID(_ownerID), scriptModIdx(scriptObj->GetOverridingModIdx()), addVars(_addVars), resolved(0) {}
+
+	AuxVarVarsMap *Get(const char *varName, bool *outIsTemp)
 	{
-		SInt32 size = valsArr->Size();
-		if (addVal && ((idx < 0) || (idx == size)))
-			return valsArr->Append();
-		if (size && (idx < size))
+		bool isTemp = (*varName == '*'), isPublic = (varName[isTemp] == '_');
+		*outIsTemp = isTemp;
+		UInt32 slot = isTemp | (isPublic << 1);
+		if (!(resolved & (1 << slot)))
 		{
-			if (idx < 0)
-				idx = size - 1;
-			return &(*valsArr)[idx];
+			resolved |= 1 << slot;
+			AuxVarModsMap &modsMap = s_auxVariables[isTemp];
+			UInt32 modIndex = isPublic ? 0xFF : scriptModIdx;
+			if (addVars)
+				varsMaps[slot] = &modsMap[modIndex][ownerID];
+			else if (AuxVarOwnersMap *ownersMap = modsMap.GetPtr(modIndex))
+				varsMaps[slot] = ownersMap->GetPtr(ownerID);
+			else varsMaps[slot] = nullptr;
 		}
+		return varsMaps[slot];
 	}
-	return nullptr;
+};
+
+__forceinline bool IsValidAuxVarName(const char *varName)
+{
+	return varName && *varName && (StrLen(varName) < 0x50);
 }
 
 void __fastcall MarkVarModified(TESObjectREFR *thisObj)
@@ -58,7 +106,7 @@ bool Cmd_AuxiliaryVariableGetSize_Execute(COMMAND_ARGS)
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &varName, &form))
 		if (AuxVarInfo varInfo = {form, thisObj, scriptObj, varName})
 		{
-			AUX_VAR_CS
+			AUX_VAR_READ_CS
 			if (AuxVarValsArr *valsArr = varInfo.GetArray())
 				*result = (int)valsArr->Size();
 		}
@@ -73,7 +121,7 @@ bool Cmd_AuxiliaryVariableGetType_Execute(COMMAND_ARGS)
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &varName, &idx, &form))
 		if (AuxVarInfo varInfo = {form, thisObj, scriptObj, varName})
 		{
-			AUX_VAR_CS
+			AUX_VAR_READ_CS
 			if (AuxVariableValue *value = varInfo.GetValue(idx))
 				*result = value->GetType();
 		}
@@ -88,7 +136,7 @@ bool Cmd_AuxiliaryVariableGetFloat_Execute(COMMAND_ARGS)
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &varName, &idx, &form))
 		if (AuxVarInfo varInfo = {form, thisObj, scriptObj, varName})
 		{
-			AUX_VAR_CS
+			AUX_VAR_READ_CS
 			if (AuxVariableValue *value = varInfo.GetValue(idx))
 				*result = value->GetFlt();
 		}
@@ -103,7 +151,7 @@ bool Cmd_AuxiliaryVariableGetRef_Execute(COMMAND_ARGS)
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &varName, &idx, &form))
 		if (AuxVarInfo varInfo = {form, thisObj, scriptObj, varName})
 		{
-			AUX_VAR_CS
+			AUX_VAR_READ_CS
 			if (AuxVariableValue *value = varInfo.GetValue(idx))
 				REFR_RES = value->GetRef();
 		}
@@ -119,7 +167,7 @@ bool Cmd_AuxiliaryVariableGetString_Execute(COMMAND_ARGS)
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &varName, &idx, &form))
 		if (AuxVarInfo varInfo = {form, thisObj, scriptObj, varName})
 		{
-			AUX_VAR_CS
+			AUX_VAR_READ_CS
 			if (AuxVariableValue *value = varInfo.GetValue(idx))
 				resStr = value->GetStr();
 		}
@@ -134,7 +182,7 @@ bool Cmd_AuxiliaryVariableGetAsArray_Execute(COMMAND_ARGS)
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &varName, &form))
 		if (AuxVarInfo varInfo = {form, thisObj, scriptObj, varName})
 		{
-			AUX_VAR_CS
+			AUX_VAR_READ_CS
 			if (AuxVarValsArr *valsArr = varInfo.GetArray())
 			{
 				TempElements *tmpElements = GetTempElements();
@@ -154,7 +202,7 @@ bool Cmd_AuxiliaryVariableGetAll_Execute(COMMAND_ARGS)
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &type, &form))
 		if (AuxVarInfo varInfo = {form, thisObj, scriptObj, type})
 		{
-			AUX_VAR_CS
+			AUX_VAR_READ_CS
 			if (AuxVarOwnersMap *findMod = varInfo().GetPtr(varInfo.modIndex))
 				if (AuxVarVarsMap *findOwner = findMod->GetPtr(varInfo.ownerID))
 				{
@@ -318,9 +366,156 @@ bool Cmd_AuxVarGetFltCond_Eval(COMMAND_ARGS_EVAL)
 			if (const char *varName = GetStringVar((int)scriptVar->data.num); varName && *varName)
 			{
 				AuxVarInfo varInfo(nullptr, thisObj, quest->scriptable.script, (char*)varName);
-				AUX_VAR_CS
+				AUX_VAR_READ_CS
 				if (AuxVariableValue *value = varInfo.GetValue(0))
 					*result = value->GetFlt();
 			}
 	return true;
-}
\ No newline at end of file
+}
+
+bool Cmd_AuxiliaryVariableGetMulti_Execute(COMMAND_ARGS)
+{
+	UInt32 arrID;
+	SInt32 idx = 0;
+	TESForm *form = nullptr;
+	if (ExtractArgsEx(EXTRACT_ARGS_EX, &arrID, &idx, &form) && arrID)
+		if (UInt32 ownerID = GetSubjectID(form, thisObj))
+			if (NVSEArrayVar *srcArr = LookupArrayByID(arrID))
+				if (ArrayData arrData(srcArr, true); arrData.size)
+				{
+					AuxBuffer<const char*> keys(arrData.size);
+					TempElements *tmpElements = GetTempElements();
+					AuxVarBatchOwner owner(ownerID, scriptObj, false);
+					bool isTemp;
+					AUX_VAR_READ_CS
+					for (UInt32 index = 0; index < arrData.size; index++)
+						if (const char *varName = arrData.vals[index].String(); IsValidAuxVarName(varName))
+							if (AuxVarVarsMap *varsMap = owner.Get(varName, &isTemp))
+								if (AuxVarValsArr *valsArr = varsMap->GetPtr((char*)varName))
+									if (AuxVariableValue *value = AuxVarValueAt(valsArr, idx, false))
+									{
+										keys[tmpElements->Size()] = varName;
+										tmpElements->Append(value->GetAsElement());
+									}
+					*result = (int)CreateStringMap(keys, tmpElements->Data(), tmpElements->Size(), scriptObj);
+				}
+	return true;
+}
+
+bool Cmd_AuxiliaryVariableSetMulti_Execute(COMMAND_ARGS)
+{
+	UInt32 arrID;
+	SInt32 idx = 0;
+	TESForm *form = nullptr;
+	if (ExtractArgsEx(EXTRACT_ARGS_EX, &arrID, &idx, &form) && arrID)
+		if (UInt32 ownerID = GetSubjectID(form, thisObj))
+			if (NVSEArrayVar *srcArr = LookupArrayByID(arrID); srcArr && (GetContainerType(srcArr) == NVSEArrayVarInterface::kArrType_StringMap))
+				if (ArrayData arrData(srcArr, false); arrData.size)
+				{
+					AuxVarBatchOwner owner(ownerID, scriptObj, idx <= 0);
+					bool isTemp, modified = false;
+					int count = 0;
+					AUX_VAR_CS
+					for (UInt32 index = 0; index < arrData.size; index++)
+						//	Owner and variable entries are only created for names with a storable value.
+						if (char *varName = arrData.keys[index].str; IsValidAuxVarName(varName) && arrData.vals[index].IsValid() && !arrData.vals[index].IsArray())
+							if (AuxVarVarsMap *varsMap = owner.Get(varName, &isTemp))
+							{
+								AuxVarValsArr *valsArr = (idx <= 0) ? &(*varsMap)[varName] : varsMap->GetPtr(varName);
+								if (AuxVariableValue *value = valsArr ? AuxVarValueAt(valsArr, idx, true) : nullptr)
+								{
+									*value = arrData.vals[index];
+									modified |= !isTemp;
+									count++;
+								}
+							}
+					if (modified)
+						MarkVarModified(thisObj);
+					*result = count;
+				}
+	return true;
+}
+
+//	AuxVarGetForOwners/AuxVarSetForOwners: owners are resolved as the single-owner commands resolve an explicit
+//	form argument, so a reference in the owners array addresses the variables of its base form.
+bool Cmd_AuxiliaryVariableGetForOwners_Execute(COMMAND_ARGS)
+{
+	char varName[0x50];
+	UInt32 arrID;
+	SInt32 idx = 0;
+	if (ExtractArgsEx(EXTRACT_ARGS_EX, &varName, &arrID, &idx) && *varName && arrID)
+		if (NVSEArrayVar *srcArr = LookupArrayByID(arrID))
+			if (ArrayData arrData(srcArr, true); arrData.size)
+			{
+				bool isTemp = (*varName == '*');
+				UInt32 modIndex = (varName[isTemp] == '_') ? 0xFF : scriptObj->GetOverridingModIdx();
+				TempElements *tmpElements = GetTempElements();
+				AUX_VAR_READ_CS
+				AuxVarOwnersMap *ownersMap = s_auxVariables[isTemp]->GetPtr(modIndex);
+				for (UInt32 index = 0; index < arrData.size; index++)
+				{
+					AuxVariableValue *value = nullptr;
+					if (UInt32 ownerID = ownersMap ? GetSubjectID(arrData.vals[index].Form(), nullptr) : 0)
+						if (AuxVarVarsMap *varsMap = ownersMap->GetPtr(ownerID))
+							if (AuxVarValsArr *valsArr = varsMap->GetPtr(varName))
+								value = AuxVarValueAt(valsArr, idx, false);
+					if (value)
+						tmpElements->Append(value->GetAsElement());
+					else tmpElements->Append(0.0);
+				}
+				*result = (int)CreateArray(tmpElements->Data(), tmpElements->Size(), scriptObj);
+			}
+	return true;
+}
+
+bool Cmd_AuxiliaryVariableSetForOwners_Execute(COMMAND_ARGS)
+{
+	char varName[0x50];
+	UInt32 ownersArrID, valsArrID;
+	SInt32 idx = 0;
+	if (ExtractArgsEx(EXTRACT_ARGS_EX, &varName, &ownersArrID, &valsArrID, &idx) && *varName && ownersArrID && valsArrID)
+	{
+		NVSEArrayVar *ownersArr = LookupArrayByID(ownersArrID), *valsArr = LookupArrayByID(valsArrID);
+		if (!ownersArr || !valsArr) return true;
+		ArrayData ownersData(ownersArr, true);
+		if (!ownersData.size) return true;
+		ArrayData valsData(valsArr, true);
+		//	Either one value per owner, or a single value assigned to all of them.
+		if ((valsData.size != ownersData.size) && (valsData.size != 1))
+			return true;
+		bool isTemp = (*varName == '*');
+		UInt32 modIndex = (varName[isTemp] == '_') ? 0xFF : scriptObj->GetOverridingModIdx();
+		int count = 0;
+		AUX_VAR_CS
+		AuxVarModsMap &modsMap = s_auxVariables[isTemp];
+		AuxVarOwnersMap *ownersMap = modsMap.GetPtr(modIndex);
+		if (!ownersMap && (idx > 0)) return true;
+		for (UInt32 index = 0; index < ownersData.size; index++)
+		{
+			const NVSEArrayElement &srcVal = valsData.vals[(valsData.size == 1) ? 0 : index];
+			if (srcVal.IsArray() || !srcVal.IsValid())
+				continue;
+			UInt32 ownerID = GetSubjectID(ownersData.vals[index].Form(), nullptr);
+			if (!ownerID) continue;
+			//	New mod, owner and variable entries are only created here, once a value is certain to be stored.
+			AuxVarValsArr *varVals;
+			if (idx <= 0)
+			{
+				if (!ownersMap) ownersMap = &modsMap[modIndex];
+				varVals = &(*ownersMap)[ownerID][varName];
+			}
+			else if (AuxVarVarsMap *varsMap = ownersMap->GetPtr(ownerID))
+				varVals = varsMap->GetPtr(varName);
+			else continue;
+			if (AuxVariableValue *value = varVals ? AuxVarValueAt(varVals, idx, true) : nullptr)
+			{
+				*value = srcVal;
+				count++;
+			}
+		}
+		if (count && !isTemp)
+			MarkVarModified(thisObj);
+		*result = count;
+	}
+	return true;
+}
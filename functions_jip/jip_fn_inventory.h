@@ -372,6 +372,7 @@ bool Cmd_GetAllItems_Execute(COMMAND_ARGS)
 		else tmpElements->Append(item);
 		count++;
 	}
+	if (listForm) InvalidateFormListIndex(listForm);
 	if (count)
 	{
 		if (listForm) *result = count;
@@ -438,6 +439,7 @@ bool Cmd_GetAllItemRefs_Execute(COMMAND_ARGS)
 			count++;
 		}
 	}
+	if (listForm) InvalidateFormListIndex(listForm);
 	if (count)
 	{
 		if (listForm) *result = count;
@@ -36,32 +36,11 @@ bool Cmd_GetLightTraitNumeric_Execute(COMMAND_ARGS)
 	return true;
 }
 
-__declspec(naked) void __fastcall MarkLightModified(TESObjectLIGH *lightForm)
+void __fastcall MarkLightModified(TESObjectLIGH *lightForm)
 {
-	__asm
-	{
-		mov		eax, offset s_activePtLights
-		mov		edx, [eax+4]
-		test	edx, edx
-		jz		done
-		push	esi
-		mov		esi, [eax]
-		ALIGN 16
-	iterHead:
-		dec		edx
-		js		iterEnd
-		mov		eax, [esi]
-		add		esi, 4
-		cmp		[eax+0xE8], ecx
-		jnz		iterHead
-		mov		[eax+0x9E], 1
-		jmp		iterHead
-		ALIGN 16
-	iterEnd:
-		pop		esi
-	done:
-		retn
-	}
+	for (auto lgtIter = s_activePtLights->Begin(); lgtIter; ++lgtIter)
+		if (lgtIter->baseLight == lightForm)
+			MarkPointLightModified(*lgtIter);
 }
 
 bool Cmd_SetLightTraitNumeric_Execute(COMMAND_ARGS)
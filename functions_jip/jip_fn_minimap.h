@@ -255,324 +255,26 @@ union SectionSeenInfo
 	IntSeenData		*seenData;
 };
 
-__declspec(naked) UInt32 __vectorcall GetSectionSeenLevel(SectionSeenInfo seenInfo, UInt32 packedBit, __m128i cellCoord)
+//	A cell's seen sections as 16 columns of 16 bits each (column = word, row = bit). Missing cells and cells without
+//	seen data read as unexplored; exterior cells flagged as fully explored (their seen data is dropped) as all set.
+alignas(16) const UInt16 kSeenColumnsNone[0x10] = {0};
+alignas(16) const UInt16 kSeenColumnsAll[0x10] =
 {
-	__asm
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
+};
+
+const UInt16* __fastcall GetSeenColumns(SectionSeenInfo seenInfo, bool isInterior, UInt32 cellXY)
+{
+	if (isInterior)
 	{
-		push	ebp
-		push	ebx
-		push	esi
-		push	edi
-		mov		ebp, ecx
-		and		edx, 0xF0F
-		movzx	eax, dl
-		shl		al, 4
-		or		al, dh
-		mov		esi, eax
-		cmp		dh, 0xF
-		setz	bl
-		shl		bl, 1
-		cmp		dl, 0xF
-		setz	bh
-		or		bh, bl
-		xor		bl, bl
-		pshufd	xmm1, xmm0, 0
-		paddw	xmm1, kSeenLvlConsts
-		cmp		byte ptr [ecx], 0xE4
-		jnz		isExterior
-		pshufb	xmm1, kSeenLvlConsts+0x10
-		pextrw	edx, xmm1, 0
-		call	GetSectionSeenData
-		mov		edi, eax
-		test	eax, eax
-		jz		noData0Int
-		mov		edx, esi
-		shr		dl, 5
-		mov		ecx, [eax+edx*4+4]
-		bt		ecx, esi
-		setc	bl
-	noData0Int:
-		mov		ecx, edi
-		test	bh, bh
-		jz		case0Both
-		cmp		bh, 2
-		jz		case2Int
-		cmp		bh, 1
-		jnz		case3Int
-		test	ecx, ecx
-		jz		noData1Int
-		lea		edx, [esi+1]
-		mov		eax, edx
-		shr		dl, 5
-		mov		ecx, [ecx+edx*4+4]
-		bt		ecx, eax
-		setc	al
-		add		bl, al
-	noData1Int:
-		pextrw	edx, xmm1, 1
-		mov		ecx, ebp
-		call	GetSectionSeenData
-		test	eax, eax
-		jz		done
-		cmp		byte ptr [eax+0x26], 0
-		jnz		caseAdd2
-		jmp		case1Both
-		ALIGN 16
-	case2Int:
-		test	ecx, ecx
-		jz		noData2Int
-		lea		edx, [esi+0x10]
-		mov		eax, edx
-		shr		dl, 5
-		mov		ecx, [ecx+edx*4+4]
-		bt		ecx, eax
-		setc	al
-		add		bl, al
-	noData2Int:
-		pextrw	edx, xmm1, 2
-		mov		ecx, ebp
-		call	GetSectionSeenData
-		test	eax, eax
-		jz		done
-		cmp		byte ptr [eax+0x26], 0
-		jnz		caseAdd2
-		jmp		case2Both
-		ALIGN 16
-	case3Int:
-		pextrw	edx, xmm1, 1
-		mov		ecx, ebp
-		call	GetSectionSeenData
-		test	eax, eax
-		jz		noData3Int
-		mov		edx, esi
-		and		dl, 0xF
-		mov		ecx, [eax+4]
-		bt		ecx, edx
-		setc	al
-		add		bl, al
-	noData3Int:
-		pextrw	edx, xmm1, 2
-		mov		ecx, ebp
-		call	GetSectionSeenData
-		test	eax, eax
-		jz		noData4Int
-		mov		edx, esi
-		and		dl, 0xF0
-		mov		ecx, edx
-		shr		dl, 5
-		mov		eax, [eax+edx*4+4]
-		bt		eax, ecx
-		setc	al
-		add		bl, al
-	noData4Int:
-		pextrw	edx, xmm1, 3
-		mov		ecx, ebp
-		call	GetSectionSeenData
-		test	eax, eax
-		jz		done
-		mov		ecx, [eax+4]
-		bt		ecx, 0
-		setc	al
-		add		bl, al
-		jmp		done
-		ALIGN 16
-	isExterior:
-		movq	xmm0, xmm1
-		call	GetGridCellSeenData
-		xor		edi, edi
-		test	eax, eax
-		jz		noDataExt
-		cmp		eax, 1
-		cmovnz	edi, eax
-		setz	bl
-		jz		noDataExt
-		mov		edx, esi
-		shr		dl, 5
-		mov		ecx, [eax+edx*4+4]
-		bt		ecx, esi
-		setc	bl
-		xor		al, al
-	noDataExt:
-		mov		ecx, edi
-		cmp		bh, 1
-		jz		case1Ext
-		cmp		bh, 2
-		jz		case2Ext
-		test	bh, bh
-		jnz		case3Ext
-		test	al, al
-		jz		case0Both
-		add		bl, 3
-		jmp		done
-		ALIGN 16
-	case0Both:
-		test	ecx, ecx
-		jz		done
-		lea		edx, [esi+0x10]
-		mov		eax, edx
-		shr		dl, 5
-		mov		ecx, [ecx+edx*4+4]
-		bt		ecx, eax
-		setc	al
-		add		bl, al
-		lea		edx, [esi+1]
-		mov		eax, edx
-		shr		dl, 5
-		mov		ecx, [edi+edx*4+4]
-		bt		ecx, eax
-		setc	al
-		add		bl, al
-		lea		edx, [esi+0x11]
-		mov		eax, edx
-		shr		dl, 5
-		mov		ecx, [edi+edx*4+4]
-		bt		ecx, eax
-		setc	al
-		add		bl, al
-		jmp		done
-		ALIGN 16
-	case1Ext:
-		test	al, al
-		jnz		modRes1
-		test	ecx, ecx
-		jz		getCell2
-		lea		edx, [esi+1]
-		mov		eax, edx
-		shr		dl, 5
-		mov		ecx, [ecx+edx*4+4]
-		bt		ecx, eax
-		setc	al
-	modRes1:
-		add		bl, al
-	getCell2:
-		pshufd	xmm0, xmm1, 1
-		mov		ecx, ebp
-		call	GetGridCellSeenData
-		test	eax, eax
-		jz		done
-		cmp		eax, 1
-		jnz		case1Both
-	caseAdd2:
-		add		bl, 2
-		jmp		done
-		ALIGN 16
-	case1Both:
-		mov		edi, eax
-		mov		edx, esi
-		and		dl, 0xF
-		mov		ecx, [eax+4]
-		bt		ecx, edx
-		setc	al
-		add		bl, al
-		lea		edx, [esi+1]
-		and		dl, 0xF
-		mov		ecx, [edi+4]
-		bt		ecx, edx
-		setc	al
-		add		bl, al
-		jmp		done
-		ALIGN 16
-	case2Ext:
-		test	al, al
-		jnz		modRes2
-		test	ecx, ecx
-		jz		getCell3
-		lea		edx, [esi+0x10]
-		mov		eax, edx
-		shr		dl, 5
-		mov		ecx, [ecx+edx*4+4]
-		bt		ecx, eax
-		setc	al
-	modRes2:
-		add		bl, al
-	getCell3:
-		pshufd	xmm0, xmm1, 2
-		mov		ecx, ebp
-		call	GetGridCellSeenData
-		test	eax, eax
-		jz		done
-		cmp		eax, 1
-		jnz		case2Both
-		add		bl, 2
-		jmp		done
-		ALIGN 16
-	case2Both:
-		mov		edi, eax
-		mov		edx, esi
-		and		dl, 0xF0
-		mov		ecx, edx
-		shr		dl, 5
-		mov		eax, [eax+edx*4+4]
-		bt		eax, ecx
-		setc	al
-		add		bl, al
-		lea		edx, [esi+0x10]
-		and		dl, 0xF0
-		mov		ecx, edx
-		shr		dl, 5
-		mov		eax, [edi+edx*4+4]
-		bt		eax, ecx
-		setc	al
-		add		bl, al
-		jmp		done
-		ALIGN 16
-	case3Ext:
-		pshufd	xmm0, xmm1, 1
-		mov		ecx, ebp
-		call	GetGridCellSeenData
-		test	eax, eax
-		jz		getCell4
-		cmp		eax, 1
-		jz		modRes3
-		mov		edx, esi
-		and		dl, 0xF
-		mov		ecx, [eax+4]
-		bt		ecx, edx
-		setc	al
-	modRes3:
-		add		bl, al
-	getCell4:
-		pshufd	xmm0, xmm1, 2
-		mov		ecx, ebp
-		call	GetGridCellSeenData
-		test	eax, eax
-		jz		getCell5
-		cmp		eax, 1
-		jz		modRes4
-		mov		edx, esi
-		and		dl, 0xF0
-		mov		ecx, edx
-		shr		dl, 5
-		mov		eax, [eax+edx*4+4]
-		bt		eax, ecx
-		setc	al
-	modRes4:
-		add		bl, al
-	getCell5:
-		pshufd	xmm0, xmm1, 3
-		mov		ecx, ebp
-		call	GetGridCellSeenData
-		test	eax, eax
-		jz		done
-		cmp		eax, 1
-		jz		modRes5
-		mov		ecx, [eax+4]
-		bt		ecx, 0
-		setc	al
-	modRes5:
-		add		bl, al
-	done:
-		movzx	eax, bl
-		pop		edi
-		pop		esi
-		pop		ebx
-		pop		ebp
-		retn
-		ALIGN 16
-	kSeenLvlConsts:
-		EMIT_DW_4(0x00000000, 0x00000001, 0x00010000, 0x00010001)
-		EMIT_DW_4(0x04060002, 0x0C0E080A, 0x80808080, 0x80808080)
+		IntSeenData *seenData = GetSectionSeenData(seenInfo.seenData, SInt16(((cellXY & 0xFF) << 8) | ((cellXY >> 0x10) & 0xFF)));
+		return seenData ? &seenData->verticalSeenBits[0].bits : kSeenColumnsNone;
 	}
+	UInt32 seenData = GetGridCellSeenData(seenInfo.cellGrid, _mm_cvtsi32_si128(cellXY));
+	if (seenData > 1)
+		return &((SeenData*)seenData)->verticalSeenBits[0].bits;
+	return seenData ? kSeenColumnsAll : kSeenColumnsNone;
 }
 
 NiTriShapeData *s_localMapShapeDatas[9];
@@ -601,67 +303,75 @@ __declspec(naked) void __fastcall PackCurrGridCoords(UInt32 currCoords)
 	}
 }
 
-__declspec(naked) void __fastcall CalcVtxAlphaBySeenData(UInt32 gridIdx)
+const UInt8 kSeenLevelByBits[] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+#define SEEN_COLUMN_MASK 0x3FFFF
+
+//	The seen columns and alpha levels last applied to each grid slot. Slots whose inputs are unchanged are skipped;
+//	uniform slots (fully explored or unexplored) are filled without per-vertex lookups.
+struct SeenColumnsSummary
 {
-	__asm
+	NiTriShapeData	*shapeData;
+	UInt32			columns[0x12];
+	float			levels[5];
+};
+SeenColumnsSummary s_seenColumnsCache[9];
+
+//	A vertex's alpha is set by how many of the 2x2 sections at and past it are seen. The seen columns of the cell and
+//	of its neighbours past both edges are gathered once, so each vertex costs a single lookup.
+void __fastcall CalcVtxAlphaBySeenData(UInt32 gridIdx)
+{
+	SectionSeenInfo seenInfo;
+	bool isInterior = s_pcCurrCell->IsInterior();
+	if (isInterior)
 	{
-		push	ebp
-		push	ebx
-		push	esi
-		push	edi
-		mov		ebp, g_gridCellArray
-		mov		ebx, ecx
-		mov		ecx, s_pcCurrCell
-		test	byte ptr [ecx+0x24], 1
-		jz		isExterior
-		push	kXData_ExtraSeenData
-		add		ecx, 0x28
-		call	BaseExtraList::GetByType
-		test	eax, eax
-		jz		done
-		mov		ebp, [eax+0xC]
-		test	ebp, ebp
-		jz		done
-	isExterior:
-		mov		ecx, s_localMapShapeDatas[ebx*4]
-		mov		eax, [ecx+0x34]
-		test	eax, eax
-		jz		noBuffer
-		and		dword ptr [eax+0x20], 0
-	noBuffer:
-		mov		esi, [ecx+0x28]
-		add		esi, 0xC
-		mov		edi, s_packedCellCoords[ebx*4]
-		xor		eax, eax
-		mov		bl, 0x10
-		ALIGN 16
-	iterHead:
-		mov		edx, edi
-		test	bl, 0x10
-		setnz	al
-		add		dx, ax
-		movd	xmm0, edx
-		mov		edx, ebx
-		mov		ecx, ebp
-		call	GetSectionSeenLevel
-		mov		ecx, s_vertexAlphaLevel[eax*4]
-		mov		[esi], ecx
-		add		esi, 0x10
-		dec		bl
-		jns		iterHead
-		mov		bl, 0x10
-		inc		bh
-		cmp		bh, bl
-		jb		iterHead
-		lea		edi, [edi+0x10000]
-		jz		iterHead
-	done:
-		pop		edi
-		pop		esi
-		pop		ebx
-		pop		ebp
-		retn
+		ExtraSeenData *xSeenData = GetExtraType(&s_pcCurrCell->extraDataList, ExtraSeenData);
+		if (!xSeenData || !xSeenData->data) return;
+		seenInfo.seenData = (IntSeenData*)xSeenData->data;
 	}
+	else seenInfo.cellGrid = g_gridCellArray;
+	NiTriShapeData *shapeData = s_localMapShapeDatas[gridIdx];
+	UInt32 cellXY = s_packedCellCoords[gridIdx].xy, nextXY = (cellXY & 0xFFFF0000) | UInt16(cellXY + 1);
+	//	Sections 0-17 on both axes; the low word of each column is this cell's row, the high word the next one's.
+	UInt32 columns[0x12];
+	const UInt16 *lower = GetSeenColumns(seenInfo, isInterior, cellXY), *upper = GetSeenColumns(seenInfo, isInterior, cellXY + 0x10000);
+	for (UInt32 colIdx = 0; colIdx < 0x10; colIdx++)
+		columns[colIdx] = (lower[colIdx] | (upper[colIdx] << 0x10)) & SEEN_COLUMN_MASK;
+	lower = GetSeenColumns(seenInfo, isInterior, nextXY);
+	upper = GetSeenColumns(seenInfo, isInterior, nextXY + 0x10000);
+	columns[0x10] = (lower[0] | (upper[0] << 0x10)) & SEEN_COLUMN_MASK;
+	columns[0x11] = (lower[1] | (upper[1] << 0x10)) & SEEN_COLUMN_MASK;
+
+	SeenColumnsSummary &summary = s_seenColumnsCache[gridIdx];
+	if ((summary.shapeData == shapeData) && MemCmp(summary.columns, columns, sizeof(columns)) && MemCmp(summary.levels, s_vertexAlphaLevel, sizeof(summary.levels)))
+		return;
+	summary.shapeData = shapeData;
+	MemCopy(summary.columns, columns, sizeof(columns));
+	MemCopy(summary.levels, s_vertexAlphaLevel, sizeof(summary.levels));
+
+	if (shapeData->bufferData)
+		shapeData->bufferData->streamCount = 0;
+	NiColorAlpha *vtxColor = shapeData->vertexColors;
+	UInt32 uniform = columns[0];
+	for (UInt32 colIdx = 1; colIdx < 0x12; colIdx++)
+		if (columns[colIdx] != uniform)
+		{
+			uniform = 1;
+			break;
+		}
+	if (!uniform || (uniform == SEEN_COLUMN_MASK))
+	{
+		float alpha = s_vertexAlphaLevel[uniform ? 4 : 0];
+		for (UInt32 vtxIdx = 0; vtxIdx < 0x121; vtxIdx++)
+			vtxColor[vtxIdx].a = alpha;
+		return;
+	}
+	float levelAlpha[0x10];
+	for (UInt32 bits = 0; bits < 0x10; bits++)
+		levelAlpha[bits] = s_vertexAlphaLevel[kSeenLevelByBits[bits]];
+	for (UInt32 row = 0; row <= 0x10; row++)
+		for (SInt32 col = 0x10; col >= 0; col--, vtxColor++)
+			vtxColor->a = levelAlpha[((columns[col] >> row) & 3) | (((columns[col + 1] >> row) & 3) << 2)];
 }
 
 __declspec(naked) UInt32 __vectorcall GetFOWUpdateMask(__m128i inPos)
@@ -714,6 +424,8 @@ __declspec(naked) void __vectorcall DoSelectiveFOWUpdate(__m128 adjustedPos)
 
 bool s_updateFogOfWar = false;
 
+//	Marks the sections in sight around the player; each column of the bitmap takes a single contiguous mask.
+//	Returns true once every section of the cell is seen (ecx is left pointing to seenData).
 __declspec(naked) bool __vectorcall UpdateSeenBits(SeenData *seenData, __m128i relPos)
 {
 	__asm
@@ -722,71 +434,72 @@ __declspec(naked) bool __vectorcall UpdateSeenBits(SeenData *seenData, __m128i r
 		push	ebx
 		push	esi
 		push	edi
-		xor		eax, eax
-		push	eax
-		push	0x02030304
-		movd	edx, xmm0
-		movsx	ebp, dx
-		sar		edx, 0x10
-		push	edx
-		push	eax
-		lea		esi, [ecx+4]
-		mov		bl, 0x10
+		lea		ebp, [ecx+4]
+		movd	eax, xmm0
+		movsx	esi, ax
+		sar		eax, 0x10
+		neg		eax
+		mov		edi, eax
+		mov		ebx, 0x10
 		ALIGN 16
-	iter1Head:
+	iterHead:
 		dec		bl
-		js		iter1End
+		js		iterEnd
 		movzx	eax, bl
-		add		eax, [esp+4]
-		mov		edx, eax
-		neg		eax
-		cmovs	eax, edx
-		cmp		al, 4
-		ja		iter1Head
-		mov		cl, [esp+eax+8]
-		mov		bh, 0x10
-		ALIGN 16
-	iter2Head:
-		dec		bh
-		js		iter1Head
-		movzx	eax, bh
-		add		eax, ebp
+		add		eax, esi
 		mov		edx, eax
 		neg		eax
 		cmovs	eax, edx
-		cmp		al, cl
-		ja		iter2Head
-		mov		dl, bh
-		shl		dl, 4
-		add		dl, bl
-		mov		al, dl
-		shr		al, 5
-		lea		edi, [esi+eax*4]
-		mov		eax, [edi]
-		bts		eax, edx
-		jc		iter2Head
-		mov		[edi], eax
-		mov		[esp], 1
-		jmp		iter2Head
+		cmp		eax, 4
+		ja		iterHead
+		movzx	edx, byte ptr kSightSpan[eax]
+		lea		ecx, [edi+edx]
+		test	ecx, ecx
+		js		iterHead
+		cmp		ecx, 0xF
+		jbe		doneHigh
+		mov		ecx, 0xF
+	doneHigh:
+		mov		eax, 2
+		shl		eax, cl
+		dec		eax
+		mov		ecx, edi
+		sub		ecx, edx
+		cmp		ecx, 0xF
+		jg		iterHead
+		xor		edx, edx
+		test	ecx, ecx
+		cmovs	ecx, edx
+		or		edx, 0xFFFFFFFF
+		shl		edx, cl
+		and		eax, edx
+		movzx	edx, bl
+		movzx	ecx, word ptr [ebp+edx*2]
+		or		[ebp+edx*2], ax
+		not		ecx
+		test	ecx, eax
+		setnz	cl
+		or		bh, cl
+		jmp		iterHead
 		ALIGN 16
-	iter1End:
-		pop		eax
-		or		s_updateFogOfWar, al
-		movups	xmm0, [esi]
-		movups	xmm1, [esi+0x10]
+	iterEnd:
+		or		s_updateFogOfWar, bh
+		movups	xmm0, [ebp]
+		movups	xmm1, [ebp+0x10]
 		pand	xmm0, xmm1
 		pcmpeqd	xmm1, xmm1
 		pcmpeqd	xmm0, xmm1
 		movmskps	eax, xmm0
 		cmp		al, 0xF
 		setz	al
-		lea		ecx, [esi-4]
-		add		esp, 0xC
+		lea		ecx, [ebp-4]
 		pop		edi
 		pop		esi
 		pop		ebx
 		pop		ebp
 		retn
+	kSightSpan:
+		EMIT_DW(0x02030304) EMIT_DW_0
 	}
 }
 
@@ -1025,12 +738,24 @@ struct DoorRef
 
 typedef Vector<DoorRef> DoorRefsList;
 
-void __fastcall GetTeleportDoors(TESObjectCELL *cell, DoorRefsList *doorRefsList)
+//	Collects the doors of several cells (at most the 9 grid cells) in a single pass over the loaded teleport doors.
+void __fastcall GetTeleportDoors(TESObjectCELL **cells, DoorRefsList **doorRefsLists, UInt32 numCells)
 {
 	for (auto iter = g_loadedReferences->teleportDoors.Begin(); iter; ++iter)
-		if (TESObjectREFR *refr = iter.Get(); refr && !(refr->flags & 0x860) && (refr->parentCell == cell))
-			if (ExtraTeleport *xTeleport = GetExtraType(&refr->extraDataList, ExtraTeleport); xTeleport->data->linkedDoor)
-				doorRefsList->Append(refr, xTeleport->data->linkedDoor->parentCell);
+		if (TESObjectREFR *refr = iter.Get(); refr && !(refr->flags & 0x860))
+			for (UInt32 cellIdx = 0; cellIdx < numCells; cellIdx++)
+			{
+				if (refr->parentCell != cells[cellIdx])
+					continue;
+				if (ExtraTeleport *xTeleport = GetExtraType(&refr->extraDataList, ExtraTeleport); xTeleport->data->linkedDoor)
+					doorRefsLists[cellIdx]->Append(refr, xTeleport->data->linkedDoor->parentCell);
+				break;
+			}
+}
+
+__forceinline void GetTeleportDoors(TESObjectCELL *cell, DoorRefsList *doorRefsList)
+{
+	GetTeleportDoors(&cell, &doorRefsList, 1);
 }
 
 __declspec(naked) UInt32* __vectorcall GetVtxAlphaPtr(__m128 posMult)
@@ -1662,6 +1387,7 @@ bool Cmd_InitMiniMap_Execute(COMMAND_ARGS)
 		s_localMapShapes[index] = sciTriShp;
 		auto shapeData = (NiTriShapeData*)sciTriShp->geometryData;
 		s_localMapShapeDatas[index] = shapeData;
+		s_seenColumnsCache[index].shapeData = nullptr;
 		s_tileShaderProps[index] = localTile->shaderProp;
 		NiReplaceObject(&localTile->shaderProp->srcTexture, nullptr);
 
@@ -2076,14 +1802,28 @@ bool Cmd_UpdateMiniMap_Execute(COMMAND_ARGS)
 						if (!inGrid) drlIter.Remove();
 					}
 					s_doorRefsList->Clear();
-					DoorRefsList *listPtr;
-					for (auto pCell : s_currCellGrid)
+					DoorRefsList *gridLists[9], *newLists[9];
+					TESObjectCELL *newCells[9];
+					UInt32 numNew = 0;
+					gridIdx = 0;
+					do
+					{
+						if (TESObjectCELL *pCell = s_currCellGrid[gridIdx]; pCell && s_exteriorDoorRefs->Insert(pCell->refID, &gridLists[gridIdx]))
+						{
+							newCells[numNew] = pCell;
+							newLists[numNew++] = gridLists[gridIdx];
+						}
+					}
+					while (++gridIdx < 9);
+					if (numNew)
+						GetTeleportDoors(newCells, newLists, numNew);
+					gridIdx = 0;
+					do
 					{
-						if (!pCell) continue;
-						if (s_exteriorDoorRefs->Insert(pCell->refID, &listPtr))
-							GetTeleportDoors(pCell, listPtr);
-						s_doorRefsList->Concatenate(*listPtr);
+						if (s_currCellGrid[gridIdx])
+							s_doorRefsList->Concatenate(*gridLists[gridIdx]);
 					}
+					while (++gridIdx < 9);
 				}
 			}
 			else if (updateFogOfWar)
@@ -194,15 +194,23 @@ bool Cmd_GetEnableChildren_Execute(COMMAND_ARGS)
 
 bool Cmd_GetLinkedChildren_Execute(COMMAND_ARGS)
 {
-	ExtraLinkedRefChildren *xLinkedChildren = GetExtraType(&thisObj->extraDataList, ExtraLinkedRefChildren);
-	if (!xLinkedChildren) return true;
 	TempElements *tmpElements = GetTempElements();
-	auto iter = xLinkedChildren->children.Head();
-	do
+	if (ExtraLinkedRefChildren *xLinkedChildren = GetExtraType(&thisObj->extraDataList, ExtraLinkedRefChildren))
 	{
-		if (iter->data) tmpElements->Append(iter->data);
+		bool anyModified = !s_linkedRefModified->Empty();
+		auto iter = xLinkedChildren->children.Head();
+		do
+		{
+			//	Children whose link was set through SetLinkedRef are listed by the reverse index.
+			if (TESObjectREFR *child = iter->data; child && (!anyModified || !s_linkedRefModified->HasKey(child->refID)))
+				tmpElements->Append(child);
+		}
+		while (iter = iter->next);
 	}
-	while (iter = iter->next);
+	if (auto findLink = s_linkedRefChildren->Find(thisObj->refID))
+		for (auto childIter = findLink().Begin(); childIter; ++childIter)
+			if (TESForm *child = LookupFormByRefID(*childIter); child && IS_REFERENCE(child))
+				tmpElements->Append(child);
 	if (!tmpElements->Empty())
 		*result = (int)CreateArray(tmpElements->Data(), tmpElements->Size(), scriptObj);
 	return true;
@@ -1889,14 +1897,12 @@ bool Cmd_GetSynchronizedChildren_Execute(COMMAND_ARGS) {
 
 	SyncNode* node = syncPosManager.getIsParent(thisObj);
 
-	NVSEArrayVar* outArray = CreateArray(nullptr, 0, scriptObj); //Maybe set the size of the array upfront.
-	if (!outArray) return true;
-
+	TempElements* tmpElements = GetTempElements();
 	for (auto child : node->children) {
-		AppendElement(outArray, ArrayElementL(child->childRef));
+		tmpElements->Append(child->childRef);
 	}
 
-	*result = (int)outArray;
+	*result = (int)CreateArray(tmpElements->Data(), tmpElements->Size(), scriptObj);
 	return true;
 
 }
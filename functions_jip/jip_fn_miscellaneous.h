@@ -1399,13 +1399,13 @@ bool Cmd_HasKeyword_Execute(COMMAND_ARGS)
 
 bool Cmd_GetKeywordForms_Execute(COMMAND_ARGS)
 {
-	NVSEArrayVar *outArray = CreateArray(nullptr, 0, scriptObj);
-	*result = (int)outArray;
+	TempElements *tmpElements = GetTempElements();
 	char keyword[0x80];
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &keyword))
 		if (auto formsSet = s_keywordFormsMap->GetPtr(StrHashCI(keyword)))
 			for (auto frmIter = formsSet->Begin(); frmIter; ++frmIter)
-				AppendElement(outArray, ArrayElementL(*frmIter));
+				tmpElements->Append(*frmIter);
+	*result = (int)CreateArray(tmpElements->Data(), tmpElements->Size(), scriptObj);
 	return true;
 }
 
@@ -18,7 +18,8 @@ DEFINE_COMMAND_ALT_PLUGIN(RefMapArrayErase, RefMapErase, 0, kParams_OneString_On
 DEFINE_COMMAND_ALT_PLUGIN(RefMapArrayValidate, RefMapValidate, 0, kParams_OneString);
 DEFINE_COMMAND_ALT_PLUGIN(RefMapArrayDestroy, RefMapDestroy, 0, kParams_OneString);
 
-#define REF_MAP_CS	ScopedPrimitiveCS cs(&s_refMapCS);
+#define REF_MAP_CS	ScopedWriteRWCS cs(&s_refMapCS);
+#define REF_MAP_READ_CS	ScopedReadRWCS cs(&s_refMapCS);
 
 RefMapIDsMap *RMFind(Script *scriptObj, char *varName)
 {
@@ -36,7 +37,7 @@ bool Cmd_RefMapArrayGetSize_Execute(COMMAND_ARGS)
 	char varName[0x50];
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &varName))
 	{
-		REF_MAP_CS
+		REF_MAP_READ_CS
 		if (RefMapIDsMap *idsMap = RMFind(scriptObj, varName))
 			*result = (int)idsMap->Size();
 	}
@@ -49,7 +50,7 @@ bool Cmd_RefMapArrayGetType_Execute(COMMAND_ARGS)
 	TESForm *form = nullptr;
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &varName, &form))
 	{
-		REF_MAP_CS
+		REF_MAP_READ_CS
 		if (RefMapIDsMap *idsMap = RMFind(scriptObj, varName))
 			if (AuxVariableValue *value = idsMap->GetPtr(GetSubjectID(form, thisObj)))
 				*result = value->GetType();
@@ -63,7 +64,7 @@ bool Cmd_RefMapArrayGetFloat_Execute(COMMAND_ARGS)
 	TESForm *form = nullptr;
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &varName, &form))
 	{
-		REF_MAP_CS
+		REF_MAP_READ_CS
 		if (RefMapIDsMap *idsMap = RMFind(scriptObj, varName))
 			if (AuxVariableValue *value = idsMap->GetPtr(GetSubjectID(form, thisObj)))
 				*result = value->GetFlt();
@@ -77,7 +78,7 @@ bool Cmd_RefMapArrayGetRef_Execute(COMMAND_ARGS)
 	TESForm *form = nullptr;
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &varName, &form))
 	{
-		REF_MAP_CS
+		REF_MAP_READ_CS
 		if (RefMapIDsMap *idsMap = RMFind(scriptObj, varName))
 			if (AuxVariableValue *value = idsMap->GetPtr(GetSubjectID(form, thisObj)))
 				REFR_RES = value->GetRef();
@@ -92,7 +93,7 @@ bool Cmd_RefMapArrayGetString_Execute(COMMAND_ARGS)
 	TESForm *form = nullptr;
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &varName, &form))
 	{
-		REF_MAP_CS
+		REF_MAP_READ_CS
 		if (RefMapIDsMap *idsMap = RMFind(scriptObj, varName))
 			if (AuxVariableValue *value = idsMap->GetPtr(GetSubjectID(form, thisObj)))
 				resStr = value->GetStr();
@@ -107,7 +108,7 @@ bool Cmd_RefMapArrayGetValue_Execute(COMMAND_ARGS)
 	TESForm *form = nullptr;
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &varName, &form))
 	{
-		REF_MAP_CS
+		REF_MAP_READ_CS
 		if (RefMapIDsMap *idsMap = RMFind(scriptObj, varName))
 			if (AuxVariableValue *value = idsMap->GetPtr(GetSubjectID(form, thisObj)))
 			{
@@ -159,7 +160,7 @@ bool Cmd_RefMapArrayGetKeys_Execute(COMMAND_ARGS)
 	char varName[0x50];
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &varName))
 	{
-		REF_MAP_CS
+		REF_MAP_READ_CS
 		if (RefMapIDsMap *idsMap = RMFind(scriptObj, varName))
 		{
 			TempElements *tmpElements = GetTempElements();
@@ -178,7 +179,7 @@ bool Cmd_RefMapArrayGetAll_Execute(COMMAND_ARGS)
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &type))
 	{
 		RefMapInfo varInfo(scriptObj, type);
-		REF_MAP_CS
+		REF_MAP_READ_CS
 		if (RefMapVarsMap *findMod = varInfo().GetPtr(varInfo.modIndex); findMod && !findMod->Empty())
 		{
 			NVSEArrayVar *varsMap = CreateStringMap(nullptr, nullptr, 0, scriptObj);
@@ -39,13 +39,8 @@ bool ScriptVariableAction_Execute(COMMAND_ARGS)
 		}
 		if (actionType == 2)
 		{
-			if (auto findOwner = s_scriptVariablesBuffer->Find(form->refID))
-				if (auto findVar = findOwner().Find(varName))
-				{
-					findVar.Remove();
-					if (findOwner().Empty()) findOwner.Remove();
-					*result = 1;
-				}
+			if (RemoveScriptVariableEntry(form->refID, varName))
+				*result = 1;
 			return true;
 		}
 		Script *pScript;
@@ -101,13 +96,7 @@ bool Cmd_RemoveAllAddedVariables_Execute(COMMAND_ARGS)
 			if (!thisObj) return true;
 			form = thisObj;
 		}
-		if (auto findOwner = s_scriptVariablesBuffer->Find(form->refID))
-		{
-			UInt8 modIdx = scriptObj->GetOverridingModIdx();
-			for (auto varIter = findOwner().Begin(); varIter; ++varIter)
-				if (varIter().modIdx == modIdx) varIter.Remove();
-			if (findOwner().Empty()) findOwner.Remove();
-		}
+		RemoveScriptVariableEntries(form->refID, scriptObj->GetOverridingModIdx());
 	}
 	return true;
 }
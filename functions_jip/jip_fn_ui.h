@@ -1871,7 +1871,8 @@ bool Cmd_GetMenuItemListRefs_Execute(COMMAND_ARGS)
 		}
 		if (!container)
 			return true;
-		NVSEArrayVar *resArray = CreateMap(nullptr, nullptr, 0, scriptObj);
+		TempNumKeys *tmpKeys = GetTempNumKeys();
+		TempElements *tmpElements = GetTempElements();
 		int tileIndex = 0;
 		auto listIter = entryList->list.Head();
 		do
@@ -1880,11 +1881,14 @@ bool Cmd_GetMenuItemListRefs_Execute(COMMAND_ARGS)
 			if (!listItem || !listItem->item)
 				continue;
 			if (inclFiltered || !listItem->isFiltered)
-				SetElement(resArray, ArrayElementL(tileIndex), ArrayElementL(CreateRefForStack(container, listItem->item)));
+			{
+				tmpKeys->Append(tileIndex);
+				tmpElements->Append(CreateRefForStack(container, listItem->item));
+			}
 			tileIndex++;
 		}
 		while (listIter = listIter->next);
-		*result = (int)resArray;
+		*result = (int)CreateMap(tmpKeys->Data(), tmpElements->Data(), tmpElements->Size(), scriptObj);
 	}
 	return true;
 }
\ No newline at end of file
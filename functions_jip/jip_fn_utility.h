@@ -85,7 +85,66 @@ bool Cmd_GetMaxOf_Execute(COMMAND_ARGS)
 	return true;
 }
 
-//Update this with guard rails
+//	Files above READ_ARRAY_CHUNK_MIN are split at line boundaries and parsed by up to READ_ARRAY_WORKERS_MAX threads,
+//	the calling thread included. Form tokens are only marked by the workers and resolved afterwards, since
+//	StringToRef is not thread-safe.
+#define READ_ARRAY_WORKERS_MAX 8
+#define READ_ARRAY_CHUNK_MIN 0x40000
+
+struct ReadArrayChunk
+{
+	char			*begin, *end;
+	UInt32			numColumns;
+	UInt32			numLines;
+	TempElements	elements;
+};
+
+__forceinline void ParseArrayToken(char *token, TempElements &elements)
+{
+	if (*token == '@')
+	{
+		//	Pending ref: dataType stays invalid until resolved.
+		ArrayElementL *elem = elements.Append();
+		elem->str = token + 1;
+	}
+	else if (*token == '$')
+		elements.Append(token + 1);
+	else
+		elements.Append(StrToDbl(token));
+}
+
+DWORD WINAPI ParseArrayChunk(LPVOID param)
+{
+	ReadArrayChunk *chunk = (ReadArrayChunk*)param;
+	for (char *pos = chunk->begin; pos != chunk->end; pos++)
+		if ((*pos == '\r') || (*pos == '\n'))
+			*pos = 0;
+	for (char *lineStart = chunk->begin; lineStart < chunk->end;)
+	{
+		if (!*lineStart)
+		{
+			lineStart++;
+			continue;
+		}
+		char *lineEnd = lineStart + StrLen(lineStart), *dataPtr = lineStart;
+		chunk->numLines++;
+		UInt32 count = chunk->numColumns;
+		do
+		{
+			if (*dataPtr)
+			{
+				char *pos = GetNextToken(dataPtr, '\t');
+				ParseArrayToken(dataPtr, chunk->elements);
+				dataPtr = pos;
+			}
+			else chunk->elements.Append(0.0);
+		}
+		while (--count);
+		lineStart = lineEnd;
+	}
+	return 0;
+}
+
 bool Cmd_ReadArrayFromFile_Execute(COMMAND_ARGS)
 {
 	char filePath[0x100];
@@ -93,56 +152,84 @@ bool Cmd_ReadArrayFromFile_Execute(COMMAND_ARGS)
 	if (!ExtractArgsEx(EXTRACT_ARGS_EX, &filePath, &transpose))
 		return true;
 	ReplaceChr(filePath, '/', '\\');
-	LineIterator lineIter(filePath, GetStrArgBuffer());
-	if (!lineIter) return true;
+	MappedFile srcFile(filePath);
+	if (!srcFile) return true;
+	char *dataPtr = srcFile.Data(), *dataEnd = dataPtr + srcFile.Size(), *pos;
+	while ((*dataPtr == '\r') || (*dataPtr == '\n'))
+		dataPtr++;
+	char *lineEnd = dataPtr;
+	while (*lineEnd && (*lineEnd != '\r') && (*lineEnd != '\n'))
+		lineEnd++;
+	char *bodyPtr = lineEnd + (lineEnd != dataEnd);
+	*lineEnd = 0;
 	TempElements *tempElems = GetTempElements();
-	char *dataPtr = *lineIter, *pos;
-	++lineIter;
 	while (true)
 	{
 		pos = GetNextToken(dataPtr, '\t');
 		if (!*dataPtr) break;
-		if (*dataPtr == '@')
-			tempElems->Append(LookupFormByRefID(StringToRef(dataPtr + 1)));
-		else if (*dataPtr == '$')
-			tempElems->Append(dataPtr + 1);
-		else
-			tempElems->Append(StrToDbl(dataPtr));
+		ParseArrayToken(dataPtr, *tempElems);
 		dataPtr = pos;
 	}
 	UInt32 numColumns = tempElems->Size();
 	if (!numColumns) return true;
 	UInt32 numLines = 1, count;
-	while (lineIter)
+	if (bodyPtr < dataEnd)
 	{
-		dataPtr = *lineIter;
-		++lineIter;
-		numLines++;
-		count = numColumns;
-		do
+		UInt32 bodySize = dataEnd - bodyPtr;
+		SYSTEM_INFO sysInfo;
+		GetSystemInfo(&sysInfo);
+		UInt32 numChunks = GetMin(GetMin((UInt32)sysInfo.dwNumberOfProcessors, (UInt32)READ_ARRAY_WORKERS_MAX), bodySize / READ_ARRAY_CHUNK_MIN);
+		if (!numChunks) numChunks = 1;
+		ReadArrayChunk chunks[READ_ARRAY_WORKERS_MAX];
+		UInt32 chunkIdx = 0;
+		for (char *chunkBgn = bodyPtr; chunkBgn < dataEnd; chunkIdx++)
 		{
-			if (*dataPtr)
+			ReadArrayChunk &chunk = chunks[chunkIdx];
+			chunk.begin = chunkBgn;
+			if ((chunkIdx + 1) < numChunks)
 			{
-				pos = GetNextToken(dataPtr, '\t');
-				if (*dataPtr == '@')
-					tempElems->Append(LookupFormByRefID(StringToRef(dataPtr + 1)));
-				else if (*dataPtr == '$')
-					tempElems->Append(dataPtr + 1);
-				else
-					tempElems->Append(StrToDbl(dataPtr));
-				dataPtr = pos;
+				chunkBgn += bodySize / numChunks;
+				while ((chunkBgn < dataEnd) && (*chunkBgn != '\n'))
+					chunkBgn++;
+				if (chunkBgn < dataEnd) chunkBgn++;
 			}
-			else tempElems->Append(0.0);
+			else chunkBgn = dataEnd;
+			chunk.end = chunkBgn;
+			chunk.numColumns = numColumns;
+			chunk.numLines = 0;
+		}
+		numChunks = chunkIdx;
+		HANDLE workers[READ_ARRAY_WORKERS_MAX];
+		UInt32 numStarted = 0;
+		for (; (numStarted + 1) < numChunks; numStarted++)
+			if (!(workers[numStarted] = CreateThread(nullptr, 0, ParseArrayChunk, &chunks[numStarted + 1], 0, nullptr)))
+				break;
+		ParseArrayChunk(&chunks[0]);
+		//	Any chunk that failed to get a thread is parsed here.
+		for (chunkIdx = numStarted + 1; chunkIdx < numChunks; chunkIdx++)
+			ParseArrayChunk(&chunks[chunkIdx]);
+		if (numStarted)
+		{
+			WaitForMultipleObjects(numStarted, workers, TRUE, INFINITE);
+			for (UInt32 index = 0; index < numStarted; index++)
+				CloseHandle(workers[index]);
+		}
+		for (chunkIdx = 0; chunkIdx < numChunks; chunkIdx++)
+		{
+			numLines += chunks[chunkIdx].numLines;
+			tempElems->Concatenate(chunks[chunkIdx].elements);
 		}
-		while (--count);
 	}
+	for (auto elemIter = tempElems->Begin(); elemIter; ++elemIter)
+		if (ArrayElementL &elem = elemIter.Ref(); !elem.IsValid())
+			elem = LookupFormByRefID(StringToRef(elem.str));
 	ArrayElementL *elemPtr = tempElems->Data();
 	if ((numLines == 1) && !transpose)
 	{
 		*result = (int)CreateArray(elemPtr, numColumns, scriptObj);
 		return true;
 	}
-	NVSEArrayVar *mainArr = CreateArray(NULL, 0, scriptObj);
+	TempElements subArrays(transpose ? numLines : numColumns);
 	if (!transpose)
 	{
 		TempElements transElems(numLines);
@@ -151,7 +238,7 @@ bool Cmd_ReadArrayFromFile_Execute(COMMAND_ARGS)
 		{
 			for (UInt32 lineIdx = 0; lineIdx < numLines; lineIdx++)
 				transElems.Append(elemPtr[lineIdx * numColumns]);
-			AppendElement(mainArr, ArrayElementL(CreateArray(transElems.Data(), numLines, scriptObj)));
+			subArrays.Append(CreateArray(transElems.Data(), numLines, scriptObj));
 			transElems.Clear();
 			elemPtr++;
 		}
@@ -162,16 +249,62 @@ bool Cmd_ReadArrayFromFile_Execute(COMMAND_ARGS)
 		count = numLines;
 		do
 		{
-			AppendElement(mainArr, ArrayElementL(CreateArray(elemPtr, numColumns, scriptObj)));
+			subArrays.Append(CreateArray(elemPtr, numColumns, scriptObj));
 			elemPtr += numColumns;
 		}
 		while (--count);
 	}
-	*result = (int)mainArr;
+	*result = (int)CreateArray(subArrays.Data(), subArrays.Size(), scriptObj);
 	return true;
 }
 
-void __fastcall WriteElemToFile(TempArrayElements *colElements, UInt32 idx, FILE *theFile, bool edid)
+//	Formats WriteArrayToFile output into the string argument buffer and writes it out in STR_BUFFER_SIZE blocks.
+class ArrayFileWriter
+{
+	FILE		*theFile;
+	char		*buffer, *bufPos;
+
+	char *Reserve(UInt32 length)
+	{
+		if ((bufPos + length) > (buffer + STR_BUFFER_SIZE))
+			Flush();
+		return bufPos;
+	}
+
+public:
+	ArrayFileWriter(FILE *_theFile) : theFile(_theFile), buffer(GetStrArgBuffer()), bufPos(buffer) {}
+	~ArrayFileWriter() {Flush();}
+
+	void Flush()
+	{
+		if (bufPos == buffer) return;
+		fwrite(buffer, bufPos - buffer, 1, theFile);
+		bufPos = buffer;
+	}
+
+	void WriteChar(char chr)
+	{
+		*Reserve(1) = chr;
+		bufPos++;
+	}
+
+	void WriteStr(const char *str)
+	{
+		UInt32 length = StrLen(str);
+		if (length >= STR_BUFFER_SIZE)
+		{
+			Flush();
+			fwrite(str, length, 1, theFile);
+		}
+		else bufPos = CPY_RET_END(Reserve(length + 1), str, length);
+	}
+
+	void WriteNum(double value) {bufPos = FltToStr(Reserve(0x20), value);}
+
+	void WriteElement(TempArrayElements *colElements, UInt32 idx, bool edid);
+};
+
+void ArrayFileWriter::WriteElement(TempArrayElements *colElements, UInt32 idx, bool edid)
 {
 	if (colElements->size > idx)
 	{
@@ -179,33 +312,29 @@ void __fastcall WriteElemToFile(TempArrayElements *colElements, UInt32 idx, FILE
 		switch (elem->GetType())
 		{
 			case 1:
-			{
-				char valStr[0x20];
-				FltToStr(valStr, elem->Number());
-				fputs(valStr, theFile);
+				WriteNum(elem->Number());
 				return;
-			}
 			case 2:
 				if (elem->Form())
 				{
-					fputc('@', theFile);
+					WriteChar('@');
 					if (edid)
 						if (const char *edidStr = elem->Form()->GetEditorID(); edidStr && *edidStr)
 						{
-							fputs(edidStr, theFile);
+							WriteStr(edidStr);
 							return;
 						}
-					fputs(elem->Form()->RefToString(), theFile);
+					WriteStr(elem->Form()->RefToString());
 					return;
 				}
 				break;
 			case 3:
-				fputc('$', theFile);
-				fputs(elem->String(), theFile);
+				WriteChar('$');
+				WriteStr(elem->String());
 				return;
 		}
 	}
-	fputc('0', theFile);
+	WriteChar('0');
 }
 
 //Update this with guard rails
@@ -234,6 +363,7 @@ bool Cmd_WriteArrayToFile_Execute(COMMAND_ARGS)
 	ReplaceChr(filePath, '/', '\\');
 	if (FileStream outputFile; outputFile.OpenWrite(filePath, apnd != 0))
 	{
+		ArrayFileWriter writer(outputFile);
 		bool edid = (flags & 2) != 0;
 		if (!(flags & 1))
 		{
@@ -241,12 +371,12 @@ bool Cmd_WriteArrayToFile_Execute(COMMAND_ARGS)
 			{
 				for (UInt32 cnt = 0; cnt < topLine.size; cnt++)
 				{
-					WriteElemToFile(&columnBuffer[cnt], idx, outputFile, edid);
+					writer.WriteElement(&columnBuffer[cnt], idx, edid);
 					if ((topLine.size - cnt) > 1)
-						fputc('\t', outputFile);
+						writer.WriteChar('\t');
 				}
 				if ((numLines - idx) > 1)
-					fputc('\n', outputFile);
+					writer.WriteChar('\n');
 			}
 		}
 		else
@@ -256,12 +386,12 @@ bool Cmd_WriteArrayToFile_Execute(COMMAND_ARGS)
 				TempArrayElements *colElements = &columnBuffer[cnt];
 				for (UInt32 idx = 0; idx < numLines; idx++)
 				{
-					WriteElemToFile(colElements, idx, outputFile, edid);
+					writer.WriteElement(colElements, idx, edid);
 					if ((numLines - idx) > 1)
-						fputc('\t', outputFile);
+						writer.WriteChar('\t');
 				}
 				if ((topLine.size - cnt) > 1)
-					fputc('\n', outputFile);
+					writer.WriteChar('\n');
 			}
 		}
 		*result = 1;
@@ -350,24 +480,29 @@ bool Cmd_ClearJIPSavedData_Execute(COMMAND_ARGS)
 		return true;
 	UInt32 modIdx = scriptObj->GetOverridingModIdx();
 	if (scrVars)
-	{
-		for (auto ownerIter = s_scriptVariablesBuffer->Begin(); ownerIter; ++ownerIter)
-		{
-			for (auto varIter = ownerIter().Begin(); varIter; ++varIter)
-				if (varIter().modIdx == modIdx) varIter.Remove();
-			if (ownerIter().Empty()) ownerIter.Remove();
-		}
-	}
+		RemoveModScriptVariables(modIdx);
 	if (lnkRefs && !s_linkedRefModified->Empty())
 	{
 		for (auto refIter = s_linkedRefModified->Begin(); refIter; ++refIter)
-			if (refIter().modIdx == modIdx) refIter.Remove();
+			if (refIter().modIdx == modIdx)
+			{
+				UnlinkModifiedChild(refIter().linkID, refIter.Key());
+				refIter.Remove();
+			}
 		s_dataChangedFlags |= kChangedFlag_LinkedRefs;
 	}
-	if (auxVars && s_auxVariables[0]->Erase((auxVars == 2) ? 0xFF : modIdx))
-		s_dataChangedFlags |= kChangedFlag_AuxVars;
-	if (refMaps && s_refMapArrays[0]->Erase((refMaps == 2) ? 0xFF : modIdx))
-		s_dataChangedFlags |= kChangedFlag_RefMaps;
+	if (auxVars)
+	{
+		ScopedWriteRWCS cs(&s_auxVarCS);
+		if (s_auxVariables[0]->Erase((auxVars == 2) ? 0xFF : modIdx))
+			s_dataChangedFlags |= kChangedFlag_AuxVars;
+	}
+	if (refMaps)
+	{
+		ScopedWriteRWCS cs(&s_refMapCS);
+		if (s_refMapArrays[0]->Erase((refMaps == 2) ? 0xFF : modIdx))
+			s_dataChangedFlags |= kChangedFlag_RefMaps;
+	}
 	/*if (xData && !s_extraDataKeysMap->Empty() && (modIdx < 0xFF))
 	{
 		for (auto jedIter = s_extraDataKeysMap->Begin(); jedIter; ++jedIter)
@@ -209,7 +209,10 @@ bool Cmd_SetBaseFactionRank_Execute(COMMAND_ARGS)
 	TESActorBase *actorBase = nullptr;
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &faction, &rank, &actorBase))
 		if (actorBase || (thisObj && IS_ACTOR(thisObj) && (actorBase = (TESActorBase*)thisObj->baseForm)))
+		{
 			actorBase->baseData.SetFactionRank(faction, GetMax(rank, -1));
+			ClearActorFactionSets();
+		}
 	return true;
 }
 
@@ -111,6 +111,7 @@ bool Cmd_GetLoadedType_Execute(COMMAND_ARGS)
 	{
 		if (!noClear) listForm->list.RemoveAll();
 		GetLoadedType(formType, ((index >= 0) && (index < 255)) ? (UInt8)index : 0xFF, &listForm->list, nullptr);
+		InvalidateFormListIndex(listForm);
 	}
 	return true;
 }
@@ -325,22 +326,25 @@ bool Cmd_GetGameSettings_Execute(COMMAND_ARGS)
 	UInt32 gmstType = 3;
 	if (ExtractArgsEx(EXTRACT_ARGS_EX, &gmstType))
 	{
-		NVSEArrayVar *outArray = CreateStringMap(nullptr, nullptr, 0, scriptObj);
+		TempStrKeys *tmpKeys = GetTempStrKeys();
+		TempElements *tmpElements = GetTempElements();
 		for (auto gmstIter = s_gameSettingsMap->Begin(); gmstIter; ++gmstIter)
 		{
 			char namePrfx = *gmstIter->name | 0x20;
 			if (namePrfx == 's')
 			{
-				if (gmstType & 2)
-					SetElement(outArray, ArrayElementL(gmstIter->name), ArrayElementL(gmstIter->data.str));
+				if (!(gmstType & 2))
+					continue;
+				tmpElements->Append(gmstIter->data.str);
 			}
-			else if (gmstType & 1)
-				if (namePrfx == 'f')
-					SetElement(outArray, ArrayElementL(gmstIter->name), ArrayElementL(gmstIter->data.f));
-				else
-					SetElement(outArray, ArrayElementL(gmstIter->name), ArrayElementL(gmstIter->data.i));
+			else if (!(gmstType & 1))
+				continue;
+			else if (namePrfx == 'f')
+				tmpElements->Append(gmstIter->data.f);
+			else tmpElements->Append(gmstIter->data.i);
+			tmpKeys->Append(gmstIter->name);
 		}
-		*result = (int)outArray;
+		*result = (int)CreateStringMap(tmpKeys->Data(), tmpElements->Data(), tmpElements->Size(), scriptObj);
 	}
 	return true;
 }
\ No newline at end of file
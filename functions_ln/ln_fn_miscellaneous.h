@@ -639,6 +639,12 @@ __declspec(noinline) UInt8 __fastcall CrosshairRefInList(BGSListForm *listForm)
 	TESObjectREFR *refr = g_interfaceManager->crosshairRef;
 	if (!refr) return 0;
 	TESForm *base = IS_ID(refr->baseForm, BGSPlaceableWater) ? ((BGSPlaceableWater*)refr->baseForm)->water : refr->baseForm, *form;
+	bool refInList = FormListContains(listForm, refr), baseInList = FormListContains(listForm, base);
+	if (refInList != baseInList)
+		return refInList ? 1 : 2;
+	if (!refInList)
+		return 0;
+	//	Both listed: report whichever comes first.
 	auto iter = listForm->list.Head();
 	do
 	{
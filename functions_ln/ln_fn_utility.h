@@ -308,6 +308,81 @@ bool Cmd_RemoveINISection_Execute(COMMAND_ARGS)
 	return true;
 }
 
+#define DIR_LISTINGS_CACHE_MAX 0x80
+
+//	Directory contents by path, reused for as long as the directory's last-write time (which adding, removing or
+//	renaming an entry updates) is unchanged. Filters are matched against the cached names.
+struct DirectoryListing
+{
+	FILETIME		lastWrite;
+	Vector<char>	names;
+	Vector<UInt32>	files;
+	Vector<UInt32>	folders;
+
+	void Build(char *dirPath, char *pathEnd)
+	{
+		names.Clear();
+		files.Clear();
+		folders.Clear();
+		*(UInt16*)pathEnd = '*';
+		for (DirectoryIterator iter(dirPath); iter; ++iter)
+		{
+			bool isFile = iter.IsFile();
+			if (!isFile && !iter.IsFolder())
+				continue;
+			(isFile ? files : folders).Append(names.Size());
+			UInt32 offset = names.Size(), length = StrLen(*iter) + 1;
+			names.Resize(offset + length);
+			COPY_BYTES(names.Data() + offset, *iter, length);
+		}
+		*pathEnd = 0;
+	}
+};
+TempObject<UnorderedMap<const char*, DirectoryListing>> s_dirListings;
+PrimitiveCS s_dirListingsCS;
+
+//	dirPath must end with a backslash, at pathEnd. Must be called with s_dirListingsCS held.
+DirectoryListing* __fastcall GetDirectoryListing(char *dirPath, char *pathEnd)
+{
+	*pathEnd = 0;
+	WIN32_FILE_ATTRIBUTE_DATA attrData;
+	if (!GetFileAttributesEx(dirPath, GetFileExInfoStandard, &attrData) || !(attrData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+		return nullptr;
+	if (s_dirListings->Size() >= DIR_LISTINGS_CACHE_MAX)
+		s_dirListings->Clear();
+	DirectoryListing *listing;
+	if (!s_dirListings->Insert(dirPath, &listing) && !CompareFileTime(&listing->lastWrite, &attrData.ftLastWriteTime))
+		return listing;
+	listing->lastWrite = attrData.ftLastWriteTime;
+	listing->Build(dirPath, pathEnd);
+	return listing;
+}
+
+NVSEArrayVar* __fastcall GetFolderContents(char *dataPathFull, char *pathEnd, const char *filter, bool getFolders, Script *scriptObj)
+{
+	//	Filters reaching into subfolders are passed to FindFirstFile as before. Names only live in the iterator's
+	//	find data there, so each is appended to the array as it is found.
+	if (FindChr(filter, '\\') || FindChr(filter, '/'))
+	{
+		StrCopy(pathEnd, filter);
+		NVSEArrayVar *outArray = CreateArray(nullptr, 0, scriptObj);
+		for (DirectoryIterator iter(dataPathFull); iter; ++iter)
+			if (getFolders ? iter.IsFolder() : iter.IsFile())
+				AppendElement(outArray, ArrayElementL(*iter));
+		return outArray;
+	}
+	TempElements *tmpElements = GetTempElements();
+	ScopedPrimitiveCS cs(&s_dirListingsCS);
+	if (DirectoryListing *listing = GetDirectoryListing(dataPathFull, pathEnd))
+	{
+		const char *names = listing->names.Data();
+		for (auto offIter = (getFolders ? listing->folders : listing->files).Begin(); offIter; ++offIter)
+			if (MatchesWildcard(names + *offIter, filter))
+				tmpElements->Append(names + *offIter);
+	}
+	return CreateArray(tmpElements->Data(), tmpElements->Size(), scriptObj);
+}
+
 bool Cmd_GetFilesInFolder_Execute(COMMAND_ARGS)
 {
 	char dataPathFull[0x80], filter[0x40], *dataPath = dataPathFull + 5;
@@ -318,11 +393,7 @@ bool Cmd_GetFilesInFolder_Execute(COMMAND_ARGS)
 	ReplaceChr(dataPath, '/', '\\');
 	char *pathEnd = dataPath + StrLen(dataPath);
 	if (pathEnd[-1] != '\\') *pathEnd++ = '\\';
-	StrCopy(pathEnd, filter);
-	NVSEArrayVar *outArray = CreateArray(nullptr, 0, scriptObj);
-	for (DirectoryIterator iter(dataPathFull); iter; ++iter)
-		if (iter.IsFile()) AppendElement(outArray, ArrayElementL(*iter));
-	*result = (int)outArray;
+	*result = (int)GetFolderContents(dataPathFull, pathEnd, filter, false, scriptObj);
 	return true;
 }
 
@@ -336,11 +407,7 @@ bool Cmd_GetFoldersInFolder_Execute(COMMAND_ARGS)
 	ReplaceChr(dataPath, '/', '\\');
 	char *pathEnd = dataPath + StrLen(dataPath);
 	if (pathEnd[-1] != '\\') *pathEnd++ = '\\';
-	StrCopy(pathEnd, filter);
-	NVSEArrayVar *outArray = CreateArray(nullptr, 0, scriptObj);
-	for (DirectoryIterator iter(dataPathFull); iter; ++iter)
-		if (iter.IsFolder()) AppendElement(outArray, ArrayElementL(*iter));
-	*result = (int)outArray;
+	*result = (int)GetFolderContents(dataPathFull, pathEnd, filter, true, scriptObj);
 	return true;
 }
 
@@ -219,6 +219,32 @@ public:
 	}
 };
 
+//	Non-recursive reader-writer spinlock. Any number of readers may hold it concurrently; a waiting writer
+//	sets kFlag_WritePending, which blocks new readers until the writer has been let in.
+class PrimitiveRWCS
+{
+	enum
+	{
+		kFlag_Writer =			0x80000000,
+		kFlag_WritePending =	0x40000000,
+		kMask_Readers =			0x3FFFFFFF
+	};
+
+	volatile long	lockState = 0;
+
+public:
+	void EnterShared();
+	__forceinline void LeaveShared() {_InterlockedDecrement(&lockState);}
+	void Enter();
+	__forceinline void Leave() {_InterlockedAnd(&lockState, kFlag_WritePending);}
+};
+
+#if JIP_DEBUG
+//	Optional acquisition/contention counters for the spinlocks above, logged by DumpLockStats.
+void __fastcall RegisterLockStats(const void *lock, const char *name);
+void DumpLockStats();
+#endif
+
 template <typename T_CS> class ScopedLock
 {
 	T_CS		*cs;
@@ -228,9 +254,20 @@ public:
 	~ScopedLock() {cs->Leave();}
 };
 
+template <typename T_CS> class ScopedSharedLock
+{
+	T_CS		*cs;
+
+public:
+	ScopedSharedLock(T_CS *_cs) : cs(_cs) {cs->EnterShared();}
+	~ScopedSharedLock() {cs->LeaveShared();}
+};
+
 typedef ScopedLock<CriticalSection> ScopedCS;
 typedef ScopedLock<PrimitiveCS> ScopedPrimitiveCS;
 typedef ScopedLock<LightCS> ScopedLightCS;
+typedef ScopedLock<PrimitiveRWCS> ScopedWriteRWCS;
+typedef ScopedSharedLock<PrimitiveRWCS> ScopedReadRWCS;
 
 void PrintDebug(const char *fmt, ...);
 
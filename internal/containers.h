@@ -948,6 +948,19 @@ public:
 	UInt32 Size() const {return numKeys;}
 	bool Empty() const {return !numKeys;}
 	T_Key *Keys() {return reinterpret_cast<T_Key*>(keys);}
+	UInt32 NumAlloc() const {return numAlloc;}
+
+	//	Moves the keys to a new buffer and returns the old one unchanged; the caller frees it with Pool_CFree.
+	T_Key *Detach()
+	{
+		M_Key *prevKeys = keys;
+		if (prevKeys)
+		{
+			keys = Pool_CAlloc<M_Key>(numAlloc);
+			MemCopy(keys, prevKeys, sizeof(M_Key) * numKeys);
+		}
+		return reinterpret_cast<T_Key*>(prevKeys);
+	}
 
 	void operator=(Set &&rhs)
 	{
@@ -1753,6 +1766,32 @@ public:
 		return true;
 	}
 
+	bool Insert(Key_Arg key, T_Key *outKey)
+	{
+		if (!buckets)
+			buckets = (Bucket*)AllocBuckets(NUM_BUCKETS);
+		else if (_allow_resize)
+		{
+			if ((numEntries > numBuckets) && (numBuckets < MAP_MAX_BUCKET_COUNT))
+				ResizeTable(numBuckets << 1);
+		}
+		UInt32 hashVal = HashKey<T_Key>(key);
+		Bucket *pBucket = &buckets[hashVal & (NUM_BUCKETS - 1)];
+		for (Entry *pEntry = pBucket->entries; pEntry; pEntry = pEntry->next)
+		{
+			if (!pEntry->key.Equal(key, hashVal))
+				continue;
+			*outKey = pEntry->key.Get();
+			return false;
+		}
+		numEntries++;
+		Entry *newEntry = Pool_CAlloc<Entry>();
+		newEntry->key.Set(key, hashVal);
+		pBucket->Insert(newEntry);
+		*outKey = newEntry->key.Get();
+		return true;
+	}
+
 	void InsertList(Init_List &&inList)
 	{
 		for (auto iter = inList.begin(); iter != inList.end(); ++iter)
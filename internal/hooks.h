@@ -1065,7 +1065,7 @@ void __fastcall MenuHandleClickHook(Menu *menu, int, int tileID, Tile *clickedTi
 		for (auto filter = clickEvent.filtersMap().FindOpDir(lastClickedTilePath, false); filter; --filter)
 		{
 			if (!StrBeginsCS(lastClickedTilePath, filter.Key())) break;
-			for (auto script = filter().BeginCp(); script; ++script)
+			for (auto script = filter().BeginDispatch(); script; ++script)
 				CallFunction(*script, nullptr, 3, menu->id, tileID, clickedTile->name.m_data);
 		}
 	}
@@ -1073,7 +1073,7 @@ void __fastcall MenuHandleClickHook(Menu *menu, int, int tileID, Tile *clickedTi
 		if (EventCallbackScripts* callbacks = clickEvent.idsMap().GetPtr(tileID))
 		{
 			const char* tileName = clickedTile ? clickedTile->name.m_data : "";
-			for (auto script = callbacks->BeginCp(); script; ++script)
+			for (auto script = callbacks->BeginDispatch(); script; ++script)
 				CallFunction(*script, nullptr, 3, menu->id, tileID, tileName);
 		}
 	}
@@ -3122,8 +3122,49 @@ __declspec(naked) NiPointLight* __fastcall DestroyNiPointLightHook(NiPointLight
 	}
 }
 
+UInt32 s_destroyScriptAddr;
+
+//	Drops the script's variable name index before the game frees it.
+void* __fastcall DestroyScriptHook(Script *script, int, bool doFree)
+{
+	script->ReleaseVariableIndex();
+	return ThisCall<void*>(s_destroyScriptAddr, script, doFree);
+}
+
 TempObject<Vector<NiPointLight*>> s_activePtLights(0x40);
 
+//	Lights are binned by world XY into a uniform grid of PT_LIGHTS_GRID_CELL units. Each frame only the lights in the
+//	cells around the camera get the cheap check (attach once their scene data is released, animate), so lights far
+//	from the camera cost nothing per frame. Lights whose traits were modified are listed in s_dirtyPtLights (drained
+//	each frame). A sweep of PT_LIGHTS_SWEEP_SIZE lights per frame re-bins lights that moved and frees detached ones.
+//	The cells visited reach as far as the largest light radius seen, plus the cull range and margin.
+#define PT_LIGHTS_GRID_CELL 4096.0F
+#define PT_LIGHTS_GRID_MAX_SPAN 8
+#define PT_LIGHTS_SWEEP_SIZE 0x80
+
+//	Lights farther than PT_LIGHTS_CULL_RANGE (plus their own radius) from the camera are hidden, which takes them
+//	out of the scene; kFlag_CullHidden marks the hidden flag as set by the cull, so that it is only cleared again
+//	for lights the cull hid. A light leaves the range only once PT_LIGHTS_CULL_MARGIN past it, to prevent popping.
+#define PT_LIGHTS_CULL_RANGE 8192.0F
+#define PT_LIGHTS_CULL_MARGIN 1024.0F
+
+TempObject<Vector<NiPointLight*>> s_dirtyPtLights(0x10);
+TempObject<UnorderedMap<UInt32, Vector<NiPointLight*>>> s_ptLightsGrid;
+TempObject<UnorderedMap<NiPointLight*, UInt32>> s_ptLightsGridCells;
+UInt32 s_ptLightsTracked = 0, s_ptLightsSweepIdx = 0;
+float s_ptLightsMaxRadius = 0;
+NiVector3 s_ptLightsCullCentre;
+bool s_ptLightsCullEnabled = false;
+
+void __fastcall MarkPointLightModified(NiPointLight *pointLight)
+{
+	if (!pointLight->resetTraits)
+	{
+		pointLight->resetTraits = true;
+		s_dirtyPtLights->Append(pointLight);
+	}
+}
+
 static NiPointLight* FindExistingPointLight(NiNode* parent)
 {
 	if (!parent) return nullptr;
@@ -3218,13 +3259,17 @@ __declspec(naked) NiPointLight* __fastcall CreatePointLight(TESObjectLIGH *light
 		test	byte ptr [esi+0xA8], 0x20
 		setnz	al
 		or		[edi+0x30], al
-		mov		[edi+0x9E], 1
 		test	byte ptr [edi+0x33], 0x40
-		jnz		done
+		jnz		isActive
+		mov		byte ptr [edi+0x9E], 1
 		or		byte ptr [edi+0x33], 0x60
 		mov		ecx, offset s_activePtLights
 		call	Vector<NiPointLight*>::AllocateData
 		mov		[eax], edi
+		jmp		done
+	isActive:
+		mov		ecx, edi
+		call	MarkPointLightModified
 	done:
 		mov		eax, edi
 		pop		edi
@@ -3357,6 +3402,7 @@ __declspec(naked) void __fastcall HidePointLights(NiNode *objNode)
 		ALIGN 16
 	isLight:
 		or		byte ptr [ecx+0x30], 1
+		and		byte ptr [ecx+0x9F], 0xFD
 		jmp		iterHead
 		ALIGN 16
 	iterEnd:
@@ -4445,6 +4491,106 @@ struct SceneLightsScope {
 	}
 };
 
+// If refcount == 1 → allocate wrapper and attach (this matches the asm’s [pl+4]==1 path)
+__forceinline bool AttachPointLight(NiPointLight* pl)
+{
+	if (pl->m_uiRefCount != 1) return false;
+	if (LightingData* node = LightingData::CreatePointLight(pl, g_shadowSceneNode->portalGraph))
+		g_shadowSceneNode->queueLightData(node);
+	return true;
+}
+
+bool __fastcall PointLightInCullRange(NiPointLight* pl)
+{
+	if (!s_ptLightsCullEnabled) return true;
+	float range = PT_LIGHTS_CULL_RANGE + pl->radius;
+	if (pl->extraFlags.isInCullRange())
+		range += PT_LIGHTS_CULL_MARGIN;
+	bool inRange = Point3Distance(pl->WorldTranslate(), s_ptLightsCullCentre) <= range;
+	pl->extraFlags.setInCullRange(inRange);
+	return inRange;
+}
+
+// Hides a visible light outside the cull range, and shows a light the cull hid once it is back in range.
+// Returns whether the light is visible.
+bool __fastcall CullPointLight(NiPointLight* pl)
+{
+	bool inRange = PointLightInCullRange(pl);
+	if (pl->extraFlags.isCullHidden()) {
+		if ((pl->m_flags & NiAVObject::kNiFlag_Hidden) == 0)
+			pl->extraFlags.setCullHidden(false);	// Shown by someone else meanwhile
+		else if (!inRange)
+			return false;
+		else {
+			pl->extraFlags.setCullHidden(false);
+			pl->m_flags.remove(NiAVObject::kNiFlag_Hidden);
+			return true;
+		}
+	}
+	if ((pl->m_flags & NiAVObject::kNiFlag_Hidden) != 0)
+		return false;
+	if (inRange)
+		return true;
+	pl->extraFlags.setCullHidden(true);
+	pl->m_flags.set(NiAVObject::kNiFlag_Hidden);
+	return false;
+}
+
+__forceinline UInt32 PointLightGridKey(SInt32 cellX, SInt32 cellY)
+{
+	return ((UInt32)(UInt16)cellX << 16) | (UInt16)cellY;
+}
+
+// Files the light under the grid cell of its current position.
+void __fastcall PlacePointLight(NiPointLight* pl)
+{
+	const NiVector3& pos = pl->WorldTranslate();
+	UInt32 cellKey = PointLightGridKey(ifloor(pos.x * (1 / PT_LIGHTS_GRID_CELL)), ifloor(pos.y * (1 / PT_LIGHTS_GRID_CELL)));
+	if (s_ptLightsMaxRadius < pl->radius)
+		s_ptLightsMaxRadius = pl->radius;
+	UInt32* pCellKey;
+	if (!s_ptLightsGridCells->InsertKey(pl, &pCellKey)) {
+		if (*pCellKey == cellKey) return;
+		if (auto* cell = s_ptLightsGrid->GetPtr(*pCellKey)) {
+			cell->RemoveUnordered(pl);
+			if (cell->Empty()) s_ptLightsGrid->Erase(*pCellKey);
+		}
+	}
+	*pCellKey = cellKey;
+	s_ptLightsGrid()[cellKey].Append(pl);
+}
+
+void __fastcall RemovePointLight(NiPointLight* pl)
+{
+	if (UInt32* pCellKey = s_ptLightsGridCells->GetPtr(pl)) {
+		if (auto* cell = s_ptLightsGrid->GetPtr(*pCellKey)) {
+			cell->RemoveUnordered(pl);
+			if (cell->Empty()) s_ptLightsGrid->Erase(*pCellKey);
+		}
+		s_ptLightsGridCells->Erase(pl);
+	}
+}
+
+// Per-frame check of a light near the camera (or of every light, with no camera to cull by).
+void __fastcall VisitPointLight(NiPointLight* pl)
+{
+	if (!pl->m_parent || !CullPointLight(pl))
+		return;
+	pl->updateTraits();
+	if (!AttachPointLight(pl))
+		if (TESObjectLIGH* base = pl->baseLight; base && base->lightFlags.HasAnimation())
+			DoUpdateAnimatedLight(base, pl);
+}
+
+// Full update for a new or modified light.
+void __fastcall UpdatePointLight(NiPointLight* pl)
+{
+	if (!pl->m_parent || !CullPointLight(pl))
+		return;
+	pl->updateTraits();
+	AttachPointLight(pl);
+}
+
 static inline volatile std::uint32_t& clearClonedAnimations = *reinterpret_cast<volatile std::uint32_t*>(0x11C56E8);
 extern "C" void __fastcall UpdateAnimatedLightsHook(TES* pTES)
 {
@@ -4463,41 +4609,64 @@ extern "C" void __fastcall UpdateAnimatedLightsHook(TES* pTES)
 	SceneLightsScope lockScope;
 	auto& lightsList = s_activePtLights();
 
-	// Reverse-index loop, shrink (Pop)
-	for (UInt32 i = lightsList.Size(); i-- > 0; )
-	{
-		NiPointLight* pl = lightsList[i];
-		if (!pl) continue;
+	s_ptLightsCullEnabled = g_mainCamera != nullptr;
+	if (s_ptLightsCullEnabled)
+		s_ptLightsCullCentre = g_mainCamera->WorldTranslate();
 
-		// Detached?
-		if (pl->m_parent == nullptr) {
-			if (pl->m_uiRefCount == 0) {
-				Ni_Free(pl, 1);
-				lightsList.RemoveUnorderedAt(i);
-			}
-			continue;
+	// Lights registered since the last frame, then lights modified since
+	for (UInt32 i = s_ptLightsTracked; i < lightsList.Size(); i++)
+		if (NiPointLight* pl = lightsList[i]) {
+			UpdatePointLight(pl);
+			PlacePointLight(pl);
 		}
-
-		// Skip if hidden
-		if ((pl->m_flags & NiAVObject::kNiFlag_Hidden) != 0)
-			continue;
-
-		TESObjectLIGH* base = pl->baseLight;
-		pl->updateTraits();
-
-		// If refcount == 1 → allocate wrapper and attach (this matches the asm’s [pl+4]==1 path)
-		if (pl->m_uiRefCount == 1) {
-			LightingData* node = LightingData::CreatePointLight(pl, g_shadowSceneNode->portalGraph);
-			if (node) g_shadowSceneNode->queueLightData(node);
-			continue;
-		}
-
-		// Otherwise, update only if base->lightFlags & 0x19C8 (offset 0xA8 in TESObjectLIGH)
-		if (base && (base->lightFlags.HasAnimation())) {
-			DoUpdateAnimatedLight(base, pl);
+	for (auto dirtyIter = s_dirtyPtLights->Begin(); dirtyIter; ++dirtyIter)
+		UpdatePointLight(*dirtyIter);
+	s_dirtyPtLights->Clear();
+
+	// Lights in the grid cells within reach of the camera; every light if the cells are too many
+	bool visitAll = !s_ptLightsCullEnabled;
+	if (!visitAll) {
+		float reach = PT_LIGHTS_CULL_RANGE + PT_LIGHTS_CULL_MARGIN + s_ptLightsMaxRadius;
+		SInt32 minX = ifloor((s_ptLightsCullCentre.x - reach) * (1 / PT_LIGHTS_GRID_CELL)), maxX = ifloor((s_ptLightsCullCentre.x + reach) * (1 / PT_LIGHTS_GRID_CELL));
+		SInt32 minY = ifloor((s_ptLightsCullCentre.y - reach) * (1 / PT_LIGHTS_GRID_CELL)), maxY = ifloor((s_ptLightsCullCentre.y + reach) * (1 / PT_LIGHTS_GRID_CELL));
+		if (((maxX - minX) >= PT_LIGHTS_GRID_MAX_SPAN) || ((maxY - minY) >= PT_LIGHTS_GRID_MAX_SPAN))
+			visitAll = true;
+		else
+			for (SInt32 cellX = minX; cellX <= maxX; cellX++)
+				for (SInt32 cellY = minY; cellY <= maxY; cellY++)
+					if (auto* cell = s_ptLightsGrid->GetPtr(PointLightGridKey(cellX, cellY)))
+						for (auto cellIter = cell->Begin(); cellIter; ++cellIter)
+							VisitPointLight(*cellIter);
+	}
+	if (visitAll)
+		for (auto lgtIter = lightsList.Begin(); lgtIter; ++lgtIter)
+			if (NiPointLight* pl = *lgtIter)
+				VisitPointLight(pl);
+
+	// Sweep a slice of the list: free detached lights, re-bin and cull the rest (Pop)
+	UInt32 idx = s_ptLightsSweepIdx;
+	for (UInt32 numSweep = GetMin(lightsList.Size(), (UInt32)PT_LIGHTS_SWEEP_SIZE); numSweep && !lightsList.Empty(); numSweep--)
+	{
+		if (idx >= lightsList.Size()) idx = 0;
+		NiPointLight* pl = lightsList[idx];
+		if (pl) {
+			if (pl->m_parent == nullptr) {
+				if (pl->m_uiRefCount == 0) {
+					RemovePointLight(pl);
+					Ni_Free(pl, 1);
+					lightsList.RemoveUnorderedAt(idx);
+					continue;
+				}
+			}
+			else {
+				PlacePointLight(pl);
+				CullPointLight(pl);
+			}
 		}
+		idx++;
 	}
-
+	s_ptLightsSweepIdx = idx;
+	s_ptLightsTracked = lightsList.Size();
 }
 
 /*
@@ -4853,7 +5022,7 @@ __declspec(naked) bool __fastcall DestroyRefrHook(TESObjectREFR *refr)
 		or		eax, s_auxVariables+0x14
 		jz		doneVars
 		mov		ecx, offset s_auxVarCS
-		call	PrimitiveCS::Enter
+		call	PrimitiveRWCS::Enter
 		mov		eax, [esi+0xC]
 		push	eax
 		push	eax
@@ -4862,7 +5031,7 @@ __declspec(naked) bool __fastcall DestroyRefrHook(TESObjectREFR *refr)
 		or		s_dataChangedFlags, al
 		mov		ecx, offset s_auxVariables+0xC
 		call	ClearRefAuxVars
-		and		s_auxVarCS.selfPtr, 0
+		lock and	s_auxVarCS.lockState, 0x40000000
 	doneVars:
 		mov		eax, [esi+0x20]
 		cmp		byte ptr [eax+4], kFormType_TESFurniture
@@ -5587,6 +5756,8 @@ __declspec(noinline) void InitJIPHooks()
 	SAFE_WRITE_BUF(0xA68D6B, "\x8B\x86\x9C\x00\x00\x00\x89\x87\x9C\x00\x00\x00");
 	WriteRelJump(0x447155, (UInt32)LoadNifRetnNodeHook);
 	SafeWrite32(0x109DD0C, (UInt32)DestroyNiPointLightHook);
+	s_destroyScriptAddr = *(UInt32*)kVtbl_Script;
+	SafeWrite32(kVtbl_Script, (UInt32)DestroyScriptHook);
 	WriteRelJump(0x50EF46, (UInt32)CreateObjectNodeHook);
 	SafeWrite32(0x1016BE0, (UInt32)DoQueuedReferenceHook);
 	SafeWrite32(0x1016D28, (UInt32)DoQueuedReferenceHook);
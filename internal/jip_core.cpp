@@ -147,6 +147,20 @@ __declspec(noinline) TempElements *GetTempElements()
 	return *s_tempElements;
 }
 
+__declspec(noinline) TempNumKeys *GetTempNumKeys()
+{
+	thread_local static TempObject<TempNumKeys> s_tempNumKeys;
+	s_tempNumKeys->Clear();
+	return *s_tempNumKeys;
+}
+
+__declspec(noinline) TempStrKeys *GetTempStrKeys()
+{
+	thread_local static TempObject<TempStrKeys> s_tempStrKeys;
+	s_tempStrKeys->Clear();
+	return *s_tempStrKeys;
+}
+
 __declspec(naked) TESForm* __stdcall LookupFormByRefID(UInt32 refID)
 {
 	__asm
@@ -270,10 +284,125 @@ __declspec(naked) UInt32 __fastcall GetResolvedRefID(UInt32 *refID)
 	}
 }
 
+//	Faction sets of actors queried by GetInFactionList, keyed by refID. An entry is rebuilt once the actor's base
+//	form or its ExtraFactionChanges differ from what it was built from; base faction edits flush the whole cache.
+TempObject<UnorderedMap<UInt32, ActorFactionSet>> s_actorFactionSets;
+PrimitiveCS s_actorFactionSetsCS;
+
+void ClearActorFactionSets()
+{
+	ScopedPrimitiveCS cs(&s_actorFactionSetsCS);
+	s_actorFactionSets->Clear();
+}
+
+//	Hashed membership of form lists with at least FORM_LIST_INDEX_MIN entries, keyed by list refID and built on the
+//	first query. JIP's own list writers drop the list's index (InvalidateFormListIndex); all indexes are dropped
+//	after a list-editing command runs (see InitCmdPatches) and around game loads. Edits made natively by other
+//	plugins are caught by the signature checked on each probe - the head node and the script-added count - which
+//	covers every edit except an in-place change past the head that leaves numAddedObjects untouched.
+#define FORM_LIST_INDEX_MIN 0x10
+
+struct FormListIndex
+{
+	bool					isIndexed;
+	UInt32					numAdded;
+	tList<TESForm>::Node	head;
+	UnorderedSet<UInt32>	refIDs;
+
+	bool IsCurrent(BGSListForm *listForm) const
+	{
+		return (head.data == listForm->list.Head()->data) && (head.next == listForm->list.Head()->next) && (numAdded == listForm->numAddedObjects);
+	}
+
+	void Build(BGSListForm *listForm)
+	{
+		numAdded = listForm->numAddedObjects;
+		head = *listForm->list.Head();
+		refIDs.Clear();
+		UInt32 count = 0;
+		auto iter = listForm->list.Head();
+		do
+		{
+			if (iter->data) count++;
+		}
+		while (iter = iter->next);
+		if (!(isIndexed = count >= FORM_LIST_INDEX_MIN))
+			return;
+		iter = listForm->list.Head();
+		do
+		{
+			if (iter->data)
+				refIDs.Insert(iter->data->refID);
+		}
+		while (iter = iter->next);
+	}
+};
+TempObject<UnorderedMap<UInt32, FormListIndex>> s_formListIndexes;
+PrimitiveCS s_formListIndexesCS;
+
+FormListIndex* __fastcall GetFormListIndex(BGSListForm *listForm)
+{
+	FormListIndex *index;
+	if (s_formListIndexes->Insert(listForm->refID, &index) || !index->IsCurrent(listForm))
+		index->Build(listForm);
+	return index->isIndexed ? index : nullptr;
+}
+
+bool __fastcall FormListContains(BGSListForm *listForm, TESForm *form)
+{
+	if (form)
+	{
+		ScopedPrimitiveCS cs(&s_formListIndexesCS);
+		if (FormListIndex *index = GetFormListIndex(listForm))
+			return index->refIDs.HasKey(form->refID);
+	}
+	return listForm->list.IsInList(form);
+}
+
+bool __fastcall FormListContainsAny(BGSListForm *listForm, TempFormList *forms)
+{
+	{
+		ScopedPrimitiveCS cs(&s_formListIndexesCS);
+		if (FormListIndex *index = GetFormListIndex(listForm))
+		{
+			for (auto formIter = forms->Begin(); formIter; ++formIter)
+				if (index->refIDs.HasKey(formIter->refID))
+					return true;
+			return false;
+		}
+	}
+	auto listIter = listForm->list.Head();
+	do
+	{
+		if (forms->HasKey(listIter->data))
+			return true;
+	}
+	while (listIter = listIter->next);
+	return false;
+}
+
+void InvalidateFormListIndexes()
+{
+	ScopedPrimitiveCS cs(&s_formListIndexesCS);
+	s_formListIndexes->Clear();
+}
+
+void __fastcall InvalidateFormListIndex(BGSListForm *listForm)
+{
+	ScopedPrimitiveCS cs(&s_formListIndexesCS);
+	s_formListIndexes->Erase(listForm->refID);
+}
+
+//	Resolved refIDs by input string. Bounded by flushing when full; flushed on new game/load, since hex IDs
+//	are resolved against the loaded save's mod indexes. Stores refIDs rather than forms, so a deleted form is
+//	never handed out - callers still go through LookupFormByRefID.
+#define STR_REFS_CACHE_MAX 0x1000
 TempObject<UnorderedMap<const char*, UInt32>> s_strRefs;
 
 UInt32 __fastcall StringToRef(char *refStr)
 {
+	if (s_strRefs->Size() >= STR_REFS_CACHE_MAX)
+		s_strRefs->Clear();
 	UInt32 *findStr;
 	if (!s_strRefs->InsertKey(refStr, &findStr)) return *findStr;
 	*findStr = 0;
@@ -660,8 +789,92 @@ float GetDaysPassed(int bgnYear, int bgnMonth, int bgnDay)
 }
 
 TempObject<UnorderedMap<UInt32, ScriptVariablesMap>> s_scriptVariablesBuffer;
+TempObject<UnorderedMap<UInt32, ScriptVariableOwners>> s_scriptVariableMods;
+//	Interned names are never released per entry; they are freed only by ClearScriptVariableEntries.
+TempObject<UnorderedSet<char*>> s_scriptVarNames;
 TempObject<UnorderedMap<UInt32, VariableNames>> s_addedVariables;
 
+const char* __fastcall InternScriptVarName(char *varName)
+{
+	char *internName;
+	s_scriptVarNames->Insert(varName, &internName);
+	return internName;
+}
+
+void __fastcall ReleaseModOwnerVariable(UInt32 modIdx, UInt32 ownerID)
+{
+	if (auto findMod = s_scriptVariableMods->Find(modIdx))
+		if (auto findOwner = findMod().Find(ownerID); findOwner && !--findOwner.Ref())
+		{
+			findOwner.Remove();
+			if (findMod().Empty()) findMod.Remove();
+		}
+}
+
+void __fastcall SetScriptVariableEntry(UInt32 ownerID, char *varName, ScriptVar *var, UInt8 modIdx)
+{
+	ScriptVariableEntry *entry;
+	if (!s_scriptVariablesBuffer()[ownerID].InsertKey(varName, &entry))
+	{
+		if (entry->modIdx == modIdx)
+		{
+			entry->value = var;
+			return;
+		}
+		ReleaseModOwnerVariable(entry->modIdx, ownerID);
+	}
+	entry->Set(var, InternScriptVarName(varName), modIdx);
+	s_scriptVariableMods()[modIdx][ownerID]++;
+}
+
+bool __fastcall RemoveScriptVariableEntry(UInt32 ownerID, char *varName)
+{
+	if (auto findOwner = s_scriptVariablesBuffer->Find(ownerID))
+		if (auto findVar = findOwner().Find(varName))
+		{
+			ReleaseModOwnerVariable(findVar().modIdx, ownerID);
+			findVar.Remove();
+			if (findOwner().Empty()) findOwner.Remove();
+			return true;
+		}
+	return false;
+}
+
+void __fastcall RemoveScriptVariableEntries(UInt32 ownerID, UInt8 modIdx)
+{
+	auto findMod = s_scriptVariableMods->Find(modIdx);
+	if (!findMod || !findMod().Erase(ownerID))
+		return;
+	if (findMod().Empty()) findMod.Remove();
+	if (auto findOwner = s_scriptVariablesBuffer->Find(ownerID))
+	{
+		for (auto varIter = findOwner().Begin(); varIter; ++varIter)
+			if (varIter().modIdx == modIdx) varIter.Remove();
+		if (findOwner().Empty()) findOwner.Remove();
+	}
+}
+
+void __fastcall RemoveModScriptVariables(UInt8 modIdx)
+{
+	auto findMod = s_scriptVariableMods->Find(modIdx);
+	if (!findMod) return;
+	for (auto ownerIter = findMod().Begin(); ownerIter; ++ownerIter)
+		if (auto findOwner = s_scriptVariablesBuffer->Find(ownerIter.Key()))
+		{
+			for (auto varIter = findOwner().Begin(); varIter; ++varIter)
+				if (varIter().modIdx == modIdx) varIter.Remove();
+			if (findOwner().Empty()) findOwner.Remove();
+		}
+	findMod.Remove();
+}
+
+void ClearScriptVariableEntries()
+{
+	s_scriptVariablesBuffer->Clear();
+	s_scriptVariableMods->Clear();
+	s_scriptVarNames->Clear();
+}
+
 bool __fastcall GetVariableAdded(UInt32 ownerID, char *varName)
 {
 	if (VariableNames *findOwner = s_addedVariables->GetPtr(ownerID); findOwner && findOwner->HasKey(varName))
@@ -676,9 +889,8 @@ ScriptVar *Script::AddVariable(char *varName, ScriptLocals *eventList, UInt32 ow
 	{
 		varInfo = Game_HeapAlloc<VariableInfo>();
 		ZeroMemory(varInfo, sizeof(VariableInfo));
-		varInfo->idx = ++info.varCount;
 		varInfo->name.Set(varName);
-		varList.Prepend(varInfo);
+		AddVariableInfo(varInfo);
 		s_addedVariables()[refID].Insert(varName);
 	}
 	else if (!GetVariableAdded(refID, varName)) return nullptr;
@@ -693,7 +905,7 @@ ScriptVar *Script::AddVariable(char *varName, ScriptLocals *eventList, UInt32 ow
 	}
 
 	if (varName[0] != '*')
-		s_scriptVariablesBuffer()[ownerID][varName].Set(var, modIdx);
+		SetScriptVariableEntry(ownerID, varName, var, modIdx);
 	return var;
 }
 
@@ -727,36 +939,60 @@ __declspec(naked) TESIdleForm *AnimData::GetPlayedIdle() const
 
 TempObject<UnorderedMap<UInt32, LinkedRefEntry>> s_linkedRefModified;
 TempObject<UnorderedMap<UInt32, UInt32>> s_linkedRefDefault, s_linkedRefsTemp;
+TempObject<LinkedRefChildrenMap> s_linkedRefChildren;
+
+//	Drops childID from the reverse-index entry of the link it was redirected to.
+void __fastcall UnlinkModifiedChild(UInt32 linkID, UInt32 childID)
+{
+	if (auto findLink = s_linkedRefChildren->Find(linkID); findLink && findLink().Erase(childID) && findLink().Empty())
+		findLink.Remove();
+}
+
+void TESObjectREFR::RevertLinkedRef(UInt32 defaultID)
+{
+	if (ExtraLinkedRef *xLinkedRef = GetExtraType(&extraDataList, ExtraLinkedRef))
+		if (!defaultID)
+			extraDataList.RemoveByType(kXData_ExtraLinkedRef);
+		else if (TESForm *form = LookupFormByRefID(defaultID); form && IS_REFERENCE(form))
+			xLinkedRef->linkedRef = (TESObjectREFR*)form;
+}
 
 bool TESObjectREFR::SetLinkedRef(TESObjectREFR *linkObj = nullptr, UInt8 modIdx)
 {
-	ExtraLinkedRef *xLinkedRef = GetExtraType(&extraDataList, ExtraLinkedRef);
 	if (!linkObj)
 	{
 		if (auto findDefID = s_linkedRefDefault->Find(refID))
 		{
-			if (xLinkedRef)
-				if (!*findDefID)
-					extraDataList.RemoveByType(kXData_ExtraLinkedRef);
-				else if (TESForm* form = LookupFormByRefID(*findDefID); form && IS_REFERENCE(form))
-					xLinkedRef->linkedRef = (TESObjectREFR*)form;
+			RevertLinkedRef(*findDefID);
 			findDefID.Remove();
 		}
-		s_linkedRefModified->Erase(refID);
+		if (auto findModified = s_linkedRefModified->Find(refID))
+		{
+			UnlinkModifiedChild(findModified().linkID, refID);
+			findModified.Remove();
+		}
 		return true;
 	}
+	ExtraLinkedRef *xLinkedRef = GetExtraType(&extraDataList, ExtraLinkedRef);
+	UInt32 *defaultID;
 	if (!xLinkedRef)
 	{
 		extraDataList.AddExtra(ExtraLinkedRef::Create(linkObj));
-		s_linkedRefDefault()[refID] = 0;
+		if (s_linkedRefDefault->InsertKey(refID, &defaultID))
+			*defaultID = 0;
 	}
 	else
 	{
 		if (!xLinkedRef->linkedRef) return false;
-		s_linkedRefDefault()[refID] = xLinkedRef->linkedRef->refID;
+		if (s_linkedRefDefault->InsertKey(refID, &defaultID))
+			*defaultID = xLinkedRef->linkedRef->refID;
 		xLinkedRef->linkedRef = linkObj;
 	}
-	s_linkedRefModified()[refID].Set(linkObj->refID, modIdx);
+	LinkedRefEntry *modEntry;
+	if (!s_linkedRefModified->InsertKey(refID, &modEntry))
+		UnlinkModifiedChild(modEntry->linkID, refID);
+	modEntry->Set(linkObj->refID, modIdx);
+	s_linkedRefChildren()[linkObj->refID].Insert(refID);
 	return true;
 }
 
@@ -774,7 +1010,7 @@ TempObject<AuxVarModsMap> s_auxVariables[2] = {8, 8};
 
 TempObject<RefMapModsMap> s_refMapArrays[2] = {8, 8};
 
-PrimitiveCS s_auxVarCS, s_refMapCS;
+PrimitiveRWCS s_auxVarCS, s_refMapCS;
 
 UInt32 __fastcall GetSubjectID(TESForm *form, TESObjectREFR *thisObj)
 {
@@ -785,33 +1021,78 @@ UInt32 __fastcall GetSubjectID(TESForm *form, TESObjectREFR *thisObj)
 
 UInt8 s_dataChangedFlags = 0;
 
+struct DetachedScripts
+{
+	void		*keys;
+	UInt32		numAlloc;
+
+	DetachedScripts(void *_keys, UInt32 _numAlloc) : keys(_keys), numAlloc(_numAlloc) {}
+};
+
+//	Key buffers of the sets being dispatched (one entry per active dispatch), and the buffers that were detached
+//	from them - freed when the last dispatch ends.
+TempObject<Vector<const void*>> s_dispatchedScripts;
+TempObject<Vector<DetachedScripts>> s_detachedScripts;
+PrimitiveCS s_eventDispatchCS;
+
+EventCallbackScripts::DispatchIterator::DispatchIterator(EventCallbackScripts &source) : Base::Iterator(source), dispatchKeys(nullptr)
+{
+	if (count)
+	{
+		dispatchKeys = pKey;
+		ScopedPrimitiveCS cs(&s_eventDispatchCS);
+		s_dispatchedScripts->Append(dispatchKeys);
+	}
+}
+
+EventCallbackScripts::DispatchIterator::~DispatchIterator()
+{
+	if (!dispatchKeys) return;
+	ScopedPrimitiveCS cs(&s_eventDispatchCS);
+	s_dispatchedScripts->Remove(dispatchKeys);
+	if (s_dispatchedScripts->Empty() && !s_detachedScripts->Empty())
+	{
+		for (auto iter = s_detachedScripts->Begin(); iter; ++iter)
+			Pool_CFree<MapKey<LambdaVarContext>>(iter().keys, iter().numAlloc);
+		s_detachedScripts->Clear();
+	}
+}
+
+void EventCallbackScripts::DetachIfDispatched()
+{
+	if (s_dispatchedScripts->Empty() || !Keys()) return;
+	ScopedPrimitiveCS cs(&s_eventDispatchCS);
+	if (s_dispatchedScripts->GetIndexOf(Keys()) >= 0)
+		s_detachedScripts->Append(Detach(), NumAlloc());
+}
+
 void EventCallbackScripts::InvokeEvents(UInt32 arg)
 {
-	for (auto script = BeginCp(); script; ++script)
+	for (auto script = BeginDispatch(); script; ++script)
 		CallFunction(*script, nullptr, 1, arg);
 }
 
 void EventCallbackScripts::InvokeEvents2(UInt32 arg1, UInt32 arg2)
 {
-	for (auto script = BeginCp(); script; ++script)
+	for (auto script = BeginDispatch(); script; ++script)
 		CallFunction(*script, nullptr, 2, arg1, arg2);
 }
 
 void EventCallbackScripts::InvokeEventsThis(TESObjectREFR *thisObj)
 {
-	for (auto script = BeginCp(); script; ++script)
+	for (auto script = BeginDispatch(); script; ++script)
 		CallFunction(*script, thisObj, 0);
 }
 
 void EventCallbackScripts::InvokeEventsThis1(TESObjectREFR *thisObj, UInt32 arg)
 {
-	for (auto script = BeginCp(); script; ++script)
+	for (auto script = BeginDispatch(); script; ++script)
 		CallFunction(*script, thisObj, 1, arg);
 }
 
 void EventCallbackScripts::InvokeEventsThis2(TESObjectREFR *thisObj, UInt32 arg1, UInt32 arg2)
 {
-	for (auto script = BeginCp(); script; ++script)
+	for (auto script = BeginDispatch(); script; ++script)
 		CallFunction(*script, thisObj, 2, arg1, arg2);
 }
 
@@ -247,8 +247,30 @@ TempFormList *GetTempFormList();
 typedef Vector<ArrayElementL, 0x100> TempElements;
 TempElements *GetTempElements();
 
+//	Per-thread key buffers, paired with GetTempElements to build maps in a single CreateMap/CreateStringMap call.
+typedef Vector<double, 0x100> TempNumKeys;
+TempNumKeys *GetTempNumKeys();
+typedef Vector<const char*, 0x100> TempStrKeys;
+TempStrKeys *GetTempStrKeys();
+
+extern TempObject<UnorderedMap<const char*, UInt32>> s_strRefs;
 UInt32 __fastcall StringToRef(char *refStr);
 
+struct ActorFactionSet
+{
+	TESActorBase	*actorBase;
+	Vector<UInt32>	changes;	// ExtraFactionChanges entries as faction pointers, low bit set for removals
+	TempFormList	factions;
+};
+extern TempObject<UnorderedMap<UInt32, ActorFactionSet>> s_actorFactionSets;
+extern PrimitiveCS s_actorFactionSetsCS;
+void ClearActorFactionSets();
+
+bool __fastcall FormListContains(BGSListForm *listForm, TESForm *form);
+bool __fastcall FormListContainsAny(BGSListForm *listForm, TempFormList *forms);
+void InvalidateFormListIndexes();
+void __fastcall InvalidateFormListIndex(BGSListForm *listForm);
+
 struct InventoryItemData
 {
 	SInt32				count;
@@ -344,16 +366,28 @@ float GetDaysPassed(int bgnYear = 2281, int bgnMonth = 9, int bgnDay = 13);
 struct ScriptVariableEntry
 {
 	ScriptVar	*value;
+	const char	*name;		//	Interned - see InternScriptVarName
 	UInt8		modIdx;
 
-	void Set(ScriptVar *_value, UInt8 _modIdx)
+	void Set(ScriptVar *_value, const char *_name, UInt8 _modIdx)
 	{
 		value = _value;
+		name = _name;
 		modIdx = _modIdx;
 	}
 };
-typedef UnorderedMap<char*, ScriptVariableEntry, 4> ScriptVariablesMap;
+typedef UnorderedMap<const char*, ScriptVariableEntry, 4> ScriptVariablesMap;
 extern TempObject<UnorderedMap<UInt32, ScriptVariablesMap>> s_scriptVariablesBuffer;
+//	For each mod, the number of variables it has added to each owner.
+typedef UnorderedMap<UInt32, UInt32> ScriptVariableOwners;
+extern TempObject<UnorderedMap<UInt32, ScriptVariableOwners>> s_scriptVariableMods;
+
+const char* __fastcall InternScriptVarName(char *varName);
+void __fastcall SetScriptVariableEntry(UInt32 ownerID, char *varName, ScriptVar *var, UInt8 modIdx);
+bool __fastcall RemoveScriptVariableEntry(UInt32 ownerID, char *varName);
+void __fastcall RemoveScriptVariableEntries(UInt32 ownerID, UInt8 modIdx);
+void __fastcall RemoveModScriptVariables(UInt8 modIdx);
+void ClearScriptVariableEntries();
 typedef UnorderedSet<const char*> VariableNames;
 
 bool __fastcall GetVariableAdded(UInt32 ownerID, char *varName);
@@ -372,6 +406,12 @@ struct LinkedRefEntry
 extern TempObject<UnorderedMap<UInt32, LinkedRefEntry>> s_linkedRefModified;
 extern TempObject<UnorderedMap<UInt32, UInt32>> s_linkedRefDefault, s_linkedRefsTemp;
 
+//	Reverse index of the links set through SetLinkedRef: link refID -> refIDs of the redirected children.
+typedef UnorderedMap<UInt32, Set<UInt32>> LinkedRefChildrenMap;
+extern TempObject<LinkedRefChildrenMap> s_linkedRefChildren;
+
+void __fastcall UnlinkModifiedChild(UInt32 linkID, UInt32 childID);
+
 bool SetLinkedRefID(UInt32 thisID, UInt32 linkID = 0, UInt8 modIdx = 0xFF);
 
 class AuxVariableValue
@@ -511,6 +551,40 @@ public:
 		return bufPos;
 	}
 
+	UInt32 GetValDataSize() const {return (type == 1) ? 8 : ((type == 2) ? 4 : (length + 2));}
+
+	static UInt8 *SkipValData(UInt8 type, UInt8 *bufPos)
+	{
+		if (type == 1)
+			return bufPos + 8;
+		if (type == 2)
+			return bufPos + 4;
+		return bufPos + *(UInt16*)bufPos + 2;
+	}
+
+	//	Same layout as WriteValData, minus the type byte.
+	UInt8 *WriteValDataTo(UInt8 *bufPos) const
+	{
+		if (type == 1)
+		{
+			*(double*)bufPos = num;
+			return bufPos + 8;
+		}
+		if (type == 2)
+		{
+			*(UInt32*)bufPos = refID;
+			return bufPos + 4;
+		}
+		*(UInt16*)bufPos = length;
+		bufPos += 2;
+		if (length)
+		{
+			COPY_BYTES(bufPos, str, length);
+			bufPos += length;
+		}
+		return bufPos;
+	}
+
 	void WriteValData() const
 	{
 		WriteRecord8(type);
@@ -538,7 +612,7 @@ typedef UnorderedMap<char*, RefMapIDsMap, 4> RefMapVarsMap;
 typedef UnorderedMap<UInt32, RefMapVarsMap> RefMapModsMap;
 extern TempObject<RefMapModsMap> s_refMapArrays[2];
 
-extern PrimitiveCS s_auxVarCS, s_refMapCS;
+extern PrimitiveRWCS s_auxVarCS, s_refMapCS;
 
 UInt32 __fastcall GetSubjectID(TESForm *form, TESObjectREFR *thisObj);
 
@@ -604,6 +678,53 @@ extern UInt8 s_dataChangedFlags;
 
 struct EventCallbackScripts : Set<LambdaVarContext, 4>
 {
+	typedef Set<LambdaVarContext, 4> Base;
+
+	//	Walks the scripts in place. A change made to the set while a dispatch over it is active moves the set to
+	//	a new buffer; the one being walked is kept intact until no dispatch is left.
+	class DispatchIterator : public Base::Iterator
+	{
+		const void	*dispatchKeys;
+
+	public:
+		DispatchIterator(EventCallbackScripts &source);
+		~DispatchIterator();
+	};
+
+	EventCallbackScripts() {}
+	~EventCallbackScripts() {DetachIfDispatched();}
+
+	void operator=(EventCallbackScripts &&rhs)
+	{
+		DetachIfDispatched();
+		Base::operator=(std::move(rhs));
+	}
+
+	bool Insert(const LambdaVarContext &script)
+	{
+		DetachIfDispatched();
+		return Base::Insert(script);
+	}
+	bool Erase(const LambdaVarContext &script)
+	{
+		DetachIfDispatched();
+		return Base::Erase(script);
+	}
+	void Clear()
+	{
+		DetachIfDispatched();
+		Base::Clear();
+	}
+	void Destroy()
+	{
+		DetachIfDispatched();
+		Base::Destroy();
+	}
+
+	void DetachIfDispatched();
+
+	DispatchIterator BeginDispatch() {return DispatchIterator(*this);}
+
 	void InvokeEvents(UInt32 arg);
 	void InvokeEvents2(UInt32 arg1, UInt32 arg2);
 	void InvokeEventsThis(TESObjectREFR *thisObj);
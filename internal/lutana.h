@@ -51,7 +51,7 @@ struct LNEventData
 	union
 	{
 		TESForm			*form;
-		tList<TESForm>	*list;
+		BGSListForm		*listForm;
 		UInt32			typeID;
 	};
 
@@ -90,17 +90,7 @@ bool LNEventData::EvalFilter(TESObjectREFR *evalRefr, TESForm *evalBase) const
 		case 0: return true;
 		case 1: return form == evalRefr;
 		case 2: return form == evalBase;
-		case 3:
-		{
-			auto iter = list->Head();
-			do
-			{
-				if ((iter->data == evalRefr) || (iter->data == evalBase))
-					return true;
-			}
-			while (iter = iter->next);
-			return false;
-		}
+		case 3: return FormListContains(listForm, evalRefr) || FormListContains(listForm, evalBase);
 		case 4: return typeID == evalBase->typeID;
 		default: return false;
 	}
@@ -147,8 +137,38 @@ const bool kValidFilterForm[] =
 UInt32 s_LNEventFlags = 0;
 UInt32 s_inputEventClear = 0;
 
+//	LN_ProcessEvents walks the handler lists in place. Registrations made while it runs are validated and
+//	report their real result at once, but changes that would reorder a list being walked (adding a key/control
+//	entry, editing an LN event list) are queued and applied once it returns.
+struct LNPendingInput
+{
+	UInt32				eventMask;
+	LambdaVarContext	script;
+	SInt32				keyID;
+
+	LNPendingInput(UInt32 _eventMask, Script *_script, SInt32 _keyID) : eventMask(_eventMask), script(_script), keyID(_keyID) {}
+};
+TempObject<Vector<LNPendingInput>> s_LNPendingInputs;
+TempObject<Vector<LNEventData>> s_LNPendingEvents;
+bool s_LNDispatching = false;
+
+//	Removes queued key/control registrations matching the arguments; keyID < 0 matches any key.
+bool RemovePendingInput(UInt32 eventMask, Script *script, SInt32 keyID)
+{
+	bool result = false;
+	for (UInt32 index = s_LNPendingInputs->Size(); index; )
+		if (LNPendingInput &pending = s_LNPendingInputs()[--index];
+			(pending.eventMask == eventMask) && (pending.script() == script) && ((keyID < 0) || (pending.keyID == keyID)))
+		{
+			s_LNPendingInputs->RemoveNth(index);
+			result = true;
+		}
+	return result;
+}
+
 bool SetInputEventHandler(UInt32 eventMask, Script *script, SInt32 keyID, bool doAdd)
 {
+	UInt32 inMask = eventMask;
 	bool onKey = (eventMask & kLNEventMask_OnKey) != 0;
 	bool onUp = (eventMask == kLNEventMask_OnKeyUp) || (eventMask == kLNEventMask_OnControlUp);
 	eventMask = onKey ? kLNEventMask_OnKey : kLNEventMask_OnControl;
@@ -157,12 +177,16 @@ bool SetInputEventHandler(UInt32 eventMask, Script *script, SInt32 keyID, bool d
 	if (keyID < 0)
 	{
 		if (!doAdd)
+		{
 			for (auto iter = events.Begin(); iter; ++iter)
 			{
 				result |= onUp ? iter().onUp.Erase(script) : iter().onDown.Erase(script);
 				if (iter().Empty())
 					s_inputEventClear |= eventMask;
 			}
+			if (s_LNDispatching)
+				result |= RemovePendingInput(inMask, script, keyID);
+		}
 		return result;
 	}
 	else if (onKey)
@@ -173,6 +197,17 @@ bool SetInputEventHandler(UInt32 eventMask, Script *script, SInt32 keyID, bool d
 	else if (keyID > 27)
 		return false;
 	LNDInpuCallbacks *callbacks;
+	//	Callback sets can be edited during dispatch, but a new key entry would move the map being walked.
+	if (s_LNDispatching && !events.HasKey(keyID))
+	{
+		if (!doAdd)
+			return RemovePendingInput(inMask, script, keyID);
+		for (auto iter = s_LNPendingInputs->Begin(); iter; ++iter)
+			if ((iter().eventMask == inMask) && (iter().script() == script) && (iter().keyID == keyID))
+				return false;
+		s_LNPendingInputs->Append(inMask, script, keyID);
+		return true;
+	}
 	if (doAdd)
 	{
 		if (events.Insert(keyID, &callbacks))
@@ -194,6 +229,49 @@ UInt32 __stdcall GetLNEventMask(const char *eventName)
 	return s_LNEventNames->Get(eventName);
 }
 
+bool UpdateLNEvents(LNEventData &evntData)
+{
+	UInt32 eventMask = 1 << evntData.eventID;
+	LNEventCallbacks *callbacks = &s_LNEvents[evntData.eventID]();
+	if (!evntData.remove)
+	{
+		if (callbacks->Find(LNEventFinder(evntData)))
+			return false;
+		*callbacks->Append() = evntData;
+		s_LNEventFlags |= eventMask;
+	}
+	else
+	{
+		if (!callbacks->Remove(LNEventFinder(evntData)))
+			return false;
+		if (callbacks->Empty()) s_LNEventFlags &= ~eventMask;
+	}
+	return true;
+}
+
+bool LNPendingEventRemoved(const LNEventData &evntData, UInt32 fromIdx)
+{
+	for (UInt32 index = fromIdx; index < s_LNPendingEvents->Size(); index++)
+		if (LNEventData &pending = s_LNPendingEvents()[index];
+			pending.remove && (pending.eventID == evntData.eventID) && (LNEventFinder(pending) == evntData))
+			return true;
+	return false;
+}
+
+//	Whether a handler matching evntData will be registered once the queued changes are applied.
+bool LNPendingEventExists(LNEventData &evntData)
+{
+	LNEventFinder finder(evntData);
+	for (auto iter = s_LNEvents[evntData.eventID]->Begin(); iter; ++iter)
+		if ((finder == *iter) && !LNPendingEventRemoved(*iter, 0))
+			return true;
+	for (UInt32 index = 0; index < s_LNPendingEvents->Size(); index++)
+		if (LNEventData &pending = s_LNPendingEvents()[index];
+			!pending.remove && (pending.eventID == evntData.eventID) && (finder == pending) && !LNPendingEventRemoved(pending, index + 1))
+			return true;
+	return false;
+}
+
 //	Called by xNVSE
 bool __stdcall ProcessLNEventHandler(UInt32 eventMask, Script *udfScript, bool addEvt, TESForm *formFilter, UInt32 numFilter)
 {
@@ -209,8 +287,8 @@ bool __stdcall ProcessLNEventHandler(UInt32 eventMask, Script *udfScript, bool a
 	{
 		if IS_ID(formFilter, BGSListForm)
 		{
-			evntData.list = &((BGSListForm*)formFilter)->list;
-			if (evntData.list->Empty())
+			evntData.listForm = (BGSListForm*)formFilter;
+			if (evntData.listForm->list.Empty())
 				return false;
 			evntData.filterType = 3;
 		}
@@ -250,26 +328,19 @@ bool __stdcall ProcessLNEventHandler(UInt32 eventMask, Script *udfScript, bool a
 		else if ((eventID >= kLNEventID_OnButtonDown) && addEvt)
 			return false;
 
-	LNEventCallbacks *callbacks = &s_LNEvents[eventID]();
-	if (addEvt)
+	if (s_LNDispatching)
 	{
-		if (callbacks->Find(LNEventFinder(evntData)))
+		if (LNPendingEventExists(evntData) != addEvt)
 			return false;
-		*callbacks->Append() = evntData;
-		s_LNEventFlags |= eventMask;
+		*s_LNPendingEvents->Append() = evntData;
+		return true;
 	}
-	else
-	{
-		if (!callbacks->Remove(LNEventFinder(evntData)))
-			return false;
-		if (callbacks->Empty()) s_LNEventFlags &= ~eventMask;
-	}
-	return true;
+	return UpdateLNEvents(evntData);
 }
 
 bool s_gameLoadFlagLN = true;
 
-void LN_ProcessEvents()
+void LN_DispatchEvents()
 {
 	static bool lastKeyState[kMaxMacros] = {0};
 
@@ -283,7 +354,7 @@ void LN_ProcessEvents()
 			if (s_LNOnKeyEvents->Empty())
 				s_LNEventFlags &= ~kLNEventMask_OnKey;
 		}
-		for (auto onKey = s_LNOnKeyEvents->BeginCp(); onKey; ++onKey)
+		for (auto onKey = s_LNOnKeyEvents->Begin(); onKey; ++onKey)
 		{
 			UInt32 key = onKey.Key();
 			bool currKeyState = g_DIHookCtrl->IsKeyPressedRaw(key);
@@ -304,11 +375,11 @@ void LN_ProcessEvents()
 			{
 				UInt16 cmprMask = changes & currButtonState;
 				if (cmprMask)
-					for (auto data = s_LNEvents[kLNEventID_OnButtonDown]->BeginCp(); data; ++data)
+					for (auto data = s_LNEvents[kLNEventID_OnButtonDown]->Begin(); data; ++data)
 						if (UInt32 outMask = cmprMask & data().typeID)
 							CallFunction(data().callback, nullptr, 1, outMask);
 				if (cmprMask = changes & lastButtonState)
-					for (auto data = s_LNEvents[kLNEventID_OnButtonUp]->BeginCp(); data; ++data)
+					for (auto data = s_LNEvents[kLNEventID_OnButtonUp]->Begin(); data; ++data)
 						if (UInt32 outMask = cmprMask & data().typeID)
 							CallFunction(data().callback, nullptr, 1, outMask);
 				lastButtonState = currButtonState;
@@ -350,11 +421,11 @@ void LN_ProcessEvents()
 		if (!gameLoaded)
 		{
 			if (s_LNEventFlags & kLNEventMask_OnCellExit)
-				for (auto data = s_LNEvents[kLNEventID_OnCellExit]->BeginCp(); data; ++data)
+				for (auto data = s_LNEvents[kLNEventID_OnCellExit]->Begin(); data; ++data)
 					if (data().EvalFilter(nullptr, lastCell))
 						CallFunction(data().callback, nullptr, 1, lastCell);
 			if (s_LNEventFlags & kLNEventMask_OnCellEnter)
-				for (auto data = s_LNEvents[kLNEventID_OnCellEnter]->BeginCp(); data; ++data)
+				for (auto data = s_LNEvents[kLNEventID_OnCellEnter]->Begin(); data; ++data)
 					if (data().EvalFilter(nullptr, currCell))
 						CallFunction(data().callback, nullptr, 1, currCell);
 		}
@@ -375,14 +446,14 @@ void LN_ProcessEvents()
 				{
 					evalRefr = lastGrabbed;
 					evalBase = lastGrabbed->baseForm;
-					for (auto data = s_LNEvents[kLNEventID_OnPlayerRelease]->BeginCp(); data; ++data)
+					for (auto data = s_LNEvents[kLNEventID_OnPlayerRelease]->Begin(); data; ++data)
 						if (data().EvalFilter(evalRefr, evalBase)) CallFunction(data().callback, nullptr, 1, lastGrabbed);
 				}
 			}
 			if (currGrabbed && (s_LNEventFlags & kLNEventMask_OnPlayerGrab))
 			{
 				evalBase = currGrabbed->baseForm;
-				for (auto data = s_LNEvents[kLNEventID_OnPlayerGrab]->BeginCp(); data; ++data)
+				for (auto data = s_LNEvents[kLNEventID_OnPlayerGrab]->Begin(); data; ++data)
 					if (data().EvalFilter(currGrabbed, evalBase)) CallFunction(data().callback, nullptr, 1, currGrabbed);
 			}
 		}
@@ -404,14 +475,14 @@ void LN_ProcessEvents()
 				{
 					evalRefr = lastCrosshair;
 					evalBase = lastCrosshair->GetBaseForm();
-					for (auto data = s_LNEvents[kLNEventID_OnCrosshairOff]->BeginCp(); data; ++data)
+					for (auto data = s_LNEvents[kLNEventID_OnCrosshairOff]->Begin(); data; ++data)
 						if (data().EvalFilter(evalRefr, evalBase)) CallFunction(data().callback, nullptr, 1, lastCrosshair);
 				}
 			}
 			if (currCrosshair && (s_LNEventFlags & kLNEventMask_OnCrosshairOn))
 			{
 				evalBase = currCrosshair->GetBaseForm();
-				for (auto data = s_LNEvents[kLNEventID_OnCrosshairOn]->BeginCp(); data; ++data)
+				for (auto data = s_LNEvents[kLNEventID_OnCrosshairOn]->Begin(); data; ++data)
 					if (data().EvalFilter(currCrosshair, evalBase)) CallFunction(data().callback, nullptr, 1, currCrosshair);
 			}
 		}
@@ -431,7 +502,7 @@ void LN_ProcessEvents()
 			if (s_LNOnControlEvents->Empty())
 				s_LNEventFlags &= ~kLNEventMask_OnControl;
 		}
-		for (auto onCtrl = s_LNOnControlEvents->BeginCp(); onCtrl; ++onCtrl)
+		for (auto onCtrl = s_LNOnControlEvents->Begin(); onCtrl; ++onCtrl)
 		{
 			UInt32 ctrl = onCtrl.Key();
 			bool currCtrlState = IsControlPressedRaw(ctrl);
@@ -441,4 +512,23 @@ void LN_ProcessEvents()
 			lastCtrlState[ctrl] = currCtrlState;
 		}
 	}
+}
+
+void LN_ProcessEvents()
+{
+	s_LNDispatching = true;
+	LN_DispatchEvents();
+	s_LNDispatching = false;
+	if (!s_LNPendingInputs->Empty())
+	{
+		for (auto iter = s_LNPendingInputs->Begin(); iter; ++iter)
+			SetInputEventHandler(iter().eventMask, iter().script, iter().keyID, true);
+		s_LNPendingInputs->Clear();
+	}
+	if (!s_LNPendingEvents->Empty())
+	{
+		for (auto iter = s_LNPendingEvents->Begin(); iter; ++iter)
+			UpdateLNEvents(iter.Ref());
+		s_LNPendingEvents->Clear();
+	}
 }
\ No newline at end of file
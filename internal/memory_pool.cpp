@@ -4,6 +4,8 @@ MemoryPool s_memoryPool;
 
 size_t MemoryPool::GetTotalAllocSize() {return s_memoryPool.m_allocPoolCount * MEMORY_POOL_SIZE;}
 
+PrimitiveCS *MemoryPool::GetLock() {return &s_memoryPool.m_cs;}
+
 __declspec(naked) void* __fastcall MemoryPool::Alloc(size_t size)
 {
 	__asm
@@ -22,6 +22,7 @@ struct MemoryPool
 	static void* __fastcall Realloc(void *pBlock, size_t curSize, size_t reqSize);
 
 	static size_t GetTotalAllocSize();
+	static PrimitiveCS *GetLock();
 };
 
 template <typename T> consteval size_t AlignAlloc()
@@ -551,6 +551,24 @@ __declspec(naked) NiAVObject* __fastcall NiNode::GetBlockByName(const char *name
 	}
 }
 
+//	Direct-mapped cache of interned block names, read without locking. Each slot owns one reference on
+//	its string, so a cached handle stays valid until the slot is overwritten; the displaced string's
+//	storage is pooled and remains readable, so a racing reader at worst fails the compare and re-interns.
+#define BLOCK_NAMES_CACHE_SIZE 0x100
+alignas(64) const char *s_blockNamesCache[BLOCK_NAMES_CACHE_SIZE];
+
+const char* __fastcall GetBlockNameHandle(const char *blockName)
+{
+	const char *volatile *pSlot = &s_blockNamesCache[StrHashCS(blockName) & (BLOCK_NAMES_CACHE_SIZE - 1)];
+	const char *nameStr = *pSlot;
+	if (nameStr && !StrCompareCS(nameStr, blockName))
+		return nameStr;
+	nameStr = GetNiFixedString(blockName);
+	if (const char *prevStr = (const char*)_InterlockedExchange((volatile long*)pSlot, (long)nameStr))
+		_InterlockedDecrement((volatile long*)(prevStr - 8));
+	return nameStr;
+}
+
 __declspec(naked) NiAVObject* __fastcall NiNode::GetBlock(const char *blockName) const
 {
 	__asm
@@ -558,12 +576,12 @@ __declspec(naked) NiAVObject* __fastcall NiNode::GetBlock(const char *blockName)
 		cmp		[edx], 0
 		jz		retnNULL
 		push	ecx
-		push	edx
-		call	GetNiFixedString
-		pop		ecx
+		mov		ecx, edx
+		call	GetBlockNameHandle
 		pop		ecx
-		lock dec dword ptr [eax-8]
-		jz		retnNULL
+		//	Only the cache holds a reference - no block can have this name.
+		cmp		dword ptr [eax-8], 1
+		jbe		retnNULL
 		cmp		[ecx+8], eax
 		jz		found
 		mov		edx, eax
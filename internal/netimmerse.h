@@ -2797,6 +2797,8 @@ struct JIPLightExtraFlags {
 
 	enum ExtraFlags {
 		kFlag_IsAnimated = BIT8(0), // set: restore local xform from vector100, then clear
+		kFlag_CullHidden = BIT8(1), // set while the light is hidden by the camera-range cull
+		kFlag_InCullRange = BIT8(2), // set while the light is within the camera culling range
 		kFlag_FromScript = BIT8(7), // set by script attach; cleared/removed on preload housekeeping
 	};
 
@@ -2805,6 +2807,12 @@ struct JIPLightExtraFlags {
 	bool isAnimated()   const { return extraFlags.hasAll(kFlag_IsAnimated); }
 	void setIsAnimated(bool on) { extraFlags.write(kFlag_IsAnimated, on); }
 
+	bool isCullHidden() const { return extraFlags.hasAll(kFlag_CullHidden); }
+	void setCullHidden(bool on) { extraFlags.write(kFlag_CullHidden, on); }
+
+	bool isInCullRange() const { return extraFlags.hasAll(kFlag_InCullRange); }
+	void setInCullRange(bool on) { extraFlags.write(kFlag_InCullRange, on); }
+
 	bool isFromScript()  const { return extraFlags.hasAll(kFlag_FromScript); }
 	void setFromScript(bool on) { extraFlags.write(kFlag_FromScript, on); }
 
@@ -2894,6 +2902,8 @@ static_assert(sizeof(NiPointLight) == 0x110);
 
 extern TempObject<Vector<NiPointLight*>> s_activePtLights;
 
+void __fastcall MarkPointLightModified(NiPointLight *pointLight);
+
 // 114
 class NiSpotLight : public NiLight
 {
@@ -54,7 +54,7 @@ bool Hook_GetContainer_Execute(COMMAND_ARGS)
 bool Hook_IsInList_Execute(COMMAND_ARGS)
 {
 	BGSListForm *formList;
-	if (ExtractArgsEx(EXTRACT_ARGS_EX, &formList) && formList->list.IsInList(thisObj->GetBaseForm()))
+	if (ExtractArgsEx(EXTRACT_ARGS_EX, &formList) && FormListContains(formList, thisObj->GetBaseForm()))
 		*result = 1;
 	DoConsolePrint(result);
 	return true;
@@ -62,7 +62,7 @@ bool Hook_IsInList_Execute(COMMAND_ARGS)
 
 bool Hook_IsInList_Eval(TESObjectREFR *thisObj, BGSListForm *formList, void *unused, double *result)
 {
-	*result = formList->list.IsInList(thisObj->GetBaseForm());
+	*result = FormListContains(formList, thisObj->GetBaseForm());
 	return true;
 }
 
@@ -410,8 +410,36 @@ bool Hook_GetPluginVersion_Execute(COMMAND_ARGS)
 	return true;
 }
 
+//	Commands that edit form lists; each is wrapped to drop the form list membership indexes once it has run.
+const char *kFormListEditCmds[] =
+{
+	"AddFormToFormList", "ListAddForm", "ListAddReference", "ListRemoveForm",
+	"ListRemoveNthForm", "ListReplaceForm", "ListReplaceNthForm", "ListClear"
+};
+Cmd_Execute s_formListEditExecute[_countof(kFormListEditCmds)];
+
+template <UInt32 cmdIdx> bool Hook_FormListEdit_Execute(COMMAND_ARGS)
+{
+	bool retn = s_formListEditExecute[cmdIdx](PASS_COMMAND_ARGS);
+	InvalidateFormListIndexes();
+	return retn;
+}
+
+template <UInt32 ...cmdIdx> void InitFormListEditHooks(std::integer_sequence<UInt32, cmdIdx...>)
+{
+	const Cmd_Execute kHooks[] = {Hook_FormListEdit_Execute<cmdIdx>...};
+	for (UInt32 index = 0; index < _countof(kFormListEditCmds); index++)
+		if (CommandInfo *cmdInfo = g_commandTbl.GetByName(kFormListEditCmds[index]); cmdInfo && cmdInfo->execute)
+		{
+			s_formListEditExecute[index] = cmdInfo->execute;
+			cmdInfo->execute = kHooks[index];
+		}
+}
+
 void InitCmdPatches()
 {
+	InitFormListEditHooks(std::make_integer_sequence<UInt32, _countof(kFormListEditCmds)>());
+
 	CommandInfo *cmdInfo = GetCmdByOpcode(0x1024);
 	cmdInfo->execute = Hook_MenuMode_Execute;
 	cmdInfo->eval = (Cmd_Eval)Hook_MenuMode_Eval;
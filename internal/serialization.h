@@ -1,6 +1,7 @@
 #pragma once
 #include "p_Plus/SyncPosition.hpp"
 #define JIP_VARS_VERSION 10
+#define JIP_REF_MAPS_VERSION 11
 
 enum JIPSerializationTags : UInt32
 {
@@ -18,12 +19,28 @@ char s_lastLoadedPath[0x80] = {0};
 
 void __fastcall RestoreLinkedRefs(UnorderedMap<UInt32, UInt32> *tempMap = nullptr)
 {
-	for (auto linkIter = s_linkedRefDefault->Begin(); linkIter;)
+	if (!tempMap)
+	{
+		for (auto linkIter = s_linkedRefDefault->Begin(); linkIter; ++linkIter)
+			if (TESForm *form = LookupFormByRefID(linkIter.Key()); form && IS_REFERENCE(form))
+				((TESObjectREFR*)form)->RevertLinkedRef(linkIter());
+		s_linkedRefDefault->Clear();
+		s_linkedRefModified->Clear();
+		s_linkedRefChildren->Clear();
+		return;
+	}
+	for (auto linkIter = s_linkedRefDefault->Begin(); linkIter; ++linkIter)
 	{
 		UInt32 key = linkIter.Key();
-		++linkIter;
-		if (!tempMap || !tempMap->HasKey(key))
-			SetLinkedRefID(key);
+		if (tempMap->HasKey(key)) continue;
+		if (TESForm *form = LookupFormByRefID(key); form && IS_REFERENCE(form))
+			((TESObjectREFR*)form)->RevertLinkedRef(linkIter());
+		if (auto findModified = s_linkedRefModified->Find(key))
+		{
+			UnlinkModifiedChild(findModified().linkID, key);
+			findModified.Remove();
+		}
+		linkIter.Remove();
 	}
 }
 
@@ -41,8 +58,128 @@ __declspec(noinline) void CleanMLCallbacks()
 
 void MiniMapLoadGame();
 
+//	Ref-map record, version 11 (columnar):
+//		UInt16 nMods; per mod: UInt8 modIdx, UInt16 nVars;
+//		per variable: UInt8 nameLen, char name[nameLen], UInt32 nRefs, UInt32 idsLength,
+//		refIDs column (sorted, delta + varint encoded, idsLength bytes), types column (nRefs bytes), values column.
+
+__forceinline UInt8 *EncodeVarInt(UInt8 *bufPos, UInt32 value)
+{
+	while (value >= 0x80)
+	{
+		*bufPos++ = (UInt8)value | 0x80;
+		value >>= 7;
+	}
+	*bufPos++ = (UInt8)value;
+	return bufPos;
+}
+
+__forceinline UInt32 DecodeVarInt(UInt8 *&bufPos)
+{
+	UInt32 value = 0;
+	for (UInt32 shift = 0; ; shift += 7)
+	{
+		UInt8 byteVal = *bufPos++;
+		value |= (UInt32)(byteVal & 0x7F) << shift;
+		if (!(byteVal & 0x80))
+			return value;
+	}
+}
+
+struct RefMapSaveEntry
+{
+	UInt32				refID;
+	AuxVariableValue	*value;
+
+	RefMapSaveEntry(UInt32 _refID, AuxVariableValue *_value) : refID(_refID), value(_value) {}
+
+	bool operator<(const RefMapSaveEntry &rhs) const {return refID < rhs.refID;}
+};
+typedef Vector<RefMapSaveEntry, 0x40> RefMapSaveEntries;
+
+void __fastcall WriteRefMapColumns(RefMapIDsMap &idsMap, RefMapSaveEntries &entries)
+{
+	entries.Clear();
+	UInt32 valsSize = 0;
+	for (auto rmRefIt = idsMap.Begin(); rmRefIt; ++rmRefIt)
+	{
+		entries.Append(rmRefIt.Key(), &rmRefIt());
+		valsSize += rmRefIt().GetValDataSize();
+	}
+	ArrayUtils<RefMapSaveEntries>::Sort(entries);
+	UInt32 nRefs = entries.Size();
+	AuxBuffer<UInt8> saveBuf(nRefs * 6 + valsSize);
+	UInt8 *bufStart = saveBuf, *bufPos = bufStart, *typesPos;
+	UInt32 prevID = 0;
+	for (auto entry = entries.Begin(); entry; ++entry)
+	{
+		bufPos = EncodeVarInt(bufPos, entry().refID - prevID);
+		prevID = entry().refID;
+	}
+	WriteRecord32(nRefs);
+	WriteRecord32(bufPos - bufStart);
+	typesPos = bufPos;
+	bufPos += nRefs;
+	for (auto entry = entries.Begin(); entry; ++entry)
+	{
+		*typesPos++ = entry().value->GetType();
+		bufPos = entry().value->WriteValDataTo(bufPos);
+	}
+	WriteRecordData(bufStart, bufPos - bufStart);
+}
+
+void __fastcall ReadRefMapColumns(Pointers &bufPos)
+{
+	UInt32 nRecs = *bufPos.s++, nVars, nRefs, idsLength, refID;
+	UInt8 modIdx, nameLen;
+	while (nRecs)
+	{
+		nRecs--;
+		modIdx = *bufPos.b++;
+		nVars = *bufPos.s++;
+		bool isValidMod = (modIdx > 5) && GetResolvedModIndex(&modIdx);
+		RefMapVarsMap *rVarsMap = nullptr;
+		while (nVars)
+		{
+			nVars--;
+			nameLen = *bufPos.b++;
+			char *namePos = bufPos.c;
+			bufPos += nameLen;
+			nRefs = *bufPos.l;
+			idsLength = bufPos.l[1];
+			*bufPos.b = 0;
+			bufPos += 8;
+			UInt8 *idsPos = bufPos.b, *typesPos = idsPos + idsLength, *valsPos = typesPos + nRefs;
+			bool loadVar = isValidMod && nameLen;
+			RefMapIDsMap *idsMap = nullptr;
+			refID = 0;
+			for (UInt32 index = 0; index < nRefs; index++)
+			{
+				refID += DecodeVarInt(idsPos);
+				UInt8 valType = typesPos[index];
+				UInt32 resolvedID = refID;
+				if (loadVar && GetResolvedRefID(&resolvedID) && (LookupFormByRefID(resolvedID) || HasChangeData(resolvedID)))
+				{
+					if (!idsMap)
+					{
+						if (!rVarsMap) rVarsMap = s_refMapArrays[0]->Emplace(modIdx, AlignBucketCount(nVars + 1));
+						//	Sized once from the stored count, so the map never rehashes while being filled.
+						idsMap = rVarsMap->Emplace(namePos, AlignBucketCount(nRefs - index));
+					}
+					valsPos = idsMap->Emplace(resolvedID, valType)->ReadValData(valsPos);
+				}
+				else valsPos = AuxVariableValue::SkipValData(valType, valsPos);
+			}
+			bufPos = valsPos;
+		}
+	}
+}
+
 void DoPreLoadGameHousekeeping()
 {
+	s_strRefs->Clear();
+	ClearActorFactionSets();
+	InvalidateFormListIndexes();
 	HOOK_SET(StartCombat, false);
 	if (!s_forceCombatTargetMap->Empty())
 	{
@@ -169,6 +306,7 @@ void RestoreJIPFormFlags()
 void DoLoadGameHousekeeping()
 {
 	RestoreJIPFormFlags();
+	InvalidateFormListIndexes();
 
 	if (g_thePlayer->teammateCount)
 	{
@@ -217,14 +355,23 @@ void DoLoadGameHousekeeping()
 void ProcessDataChangedFlags(UInt8 changedFlags)
 {
 	if (changedFlags & kChangedFlag_AuxVars)
+	{
+		ScopedWriteRWCS cs(&s_auxVarCS);
 		s_auxVariables[0]->Clear();
+	}
 	if (changedFlags & kChangedFlag_RefMaps)
+	{
+		ScopedWriteRWCS cs(&s_refMapCS);
 		s_refMapArrays[0]->Clear();
+	}
 	if (changedFlags & kChangedFlag_ExtraData)
 		s_extraDataKeysMap->Clear();
 	if (changedFlags & kChangedFlag_LinkedRefs)
+	{
 		s_linkedRefModified->Clear();
-	s_scriptVariablesBuffer->Clear();
+		s_linkedRefChildren->Clear();
+	}
+	ClearScriptVariableEntries();
 	s_linkedRefsTemp->Clear();
 	s_serializedVars.Reset();
 
@@ -323,6 +470,7 @@ void LoadGameCallback(void*)
 		{
 			if (!(changedFlags & kChangedFlag_AuxVars) || (version < JIP_VARS_VERSION))
 				continue;
+			ScopedWriteRWCS cs(&s_auxVarCS);
 			bufPos = ReadRecordToBuffer(loadBuf, length);
 			UInt16 nElems;
 			nRecs = *bufPos.s++;
@@ -416,7 +564,13 @@ void LoadGameCallback(void*)
 		{
 			if (!(changedFlags & kChangedFlag_RefMaps) || (version < JIP_VARS_VERSION))
 				continue;
+			ScopedWriteRWCS cs(&s_refMapCS);
 			bufPos = ReadRecordToBuffer(loadBuf, length);
+			if (version >= JIP_REF_MAPS_VERSION)
+			{
+				ReadRefMapColumns(bufPos);
+				continue;
+			}
 			nRecs = *bufPos.s++;
 			while (nRecs)
 			{
@@ -633,13 +787,14 @@ void SaveGameCallback(void*)
 			for (auto svVarIt = svOwnerIt().Begin(); svVarIt; ++svVarIt)
 			{
 				WriteRecord8(svVarIt().modIdx);
-				auxByte = StrLen(svVarIt.Key());
+				auxByte = StrLen(svVarIt().name);
 				WriteRecord8(auxByte);
-				WriteRecordData(svVarIt.Key(), auxByte);
+				WriteRecordData(svVarIt().name, auxByte);
 				WriteRecord64(&svVarIt().value->data);
 			}
 		}
 	}
+	s_auxVarCS.EnterShared();
 	if (auxLong = s_auxVariables[0]->Size())
 	{
 		WriteRecord(kJIPTag_AuxVars, JIP_VARS_VERSION, &auxLong, 2);
@@ -663,9 +818,12 @@ void SaveGameCallback(void*)
 			}
 		}
 	}
+	s_auxVarCS.LeaveShared();
+	s_refMapCS.EnterShared();
 	if (auxLong = s_refMapArrays[0]->Size())
 	{
-		WriteRecord(kJIPTag_RefMaps, JIP_VARS_VERSION, &auxLong, 2);
+		WriteRecord(kJIPTag_RefMaps, JIP_REF_MAPS_VERSION, &auxLong, 2);
+		RefMapSaveEntries entries;
 		for (auto rmModIt = s_refMapArrays[0]->Begin(); rmModIt; ++rmModIt)
 		{
 			WriteRecord8(rmModIt.Key());
@@ -675,15 +833,11 @@ void SaveGameCallback(void*)
 				auxByte = StrLen(rmVarIt.Key());
 				WriteRecord8(auxByte);
 				WriteRecordData(rmVarIt.Key(), auxByte);
-				WriteRecord16(rmVarIt().Size());
-				for (auto rmRefIt = rmVarIt().Begin(); rmRefIt; ++rmRefIt)
-				{
-					WriteRecord32(rmRefIt.Key());
-					rmRefIt().WriteValData();
-				}
+				WriteRefMapColumns(rmVarIt(), entries);
 			}
 		}
 	}
+	s_refMapCS.LeaveShared();
 	if (auxLong = s_extraDataKeysMap->Size())
 	{
 		WriteRecord(kJIPTag_ExtraData, ExtraJIP::kExtraJIP_Verion, &auxLong, 4);
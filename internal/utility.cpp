@@ -198,68 +198,166 @@ __declspec(naked) void __stdcall Game_HeapFree(void *ptr)
 	}
 }
 
-__declspec(naked) PrimitiveCS *PrimitiveCS::Enter()
+#define SPIN_BACKOFF_MAX 0x100
+
+//	Contended path of the spinlocks: doubles the number of pauses after every failed attempt, up to
+//	SPIN_BACKOFF_MAX, then yields the rest of the time slice and starts over.
+class SpinBackoff
 {
-	__asm
+	UInt32		pauseCount = 1;
+
+public:
+	__forceinline void operator()()
 	{
-		push	esi
-		push	edi
-		mov		esi, ecx
-		mov		edi, Sleep
-		ALIGN 16
-	spinHead:
-		xor		eax, eax
-		lock cmpxchg [ecx], esi
-		jz		done
-		push	0
-		call	edi
-		mov		ecx, esi
-		jmp		spinHead
-		ALIGN 16
-	done:
-		mov		eax, esi
-		pop		edi
-		pop		esi
-		retn
+		for (UInt32 count = pauseCount; count; count--)
+			_mm_pause();
+		if (pauseCount < SPIN_BACKOFF_MAX)
+			pauseCount <<= 1;
+		else
+		{
+			Sleep(0);
+			pauseCount = 1;
+		}
 	}
+};
+
+#if JIP_DEBUG
+#define LOCK_STATS_MAX 0x10
+
+struct LockStats
+{
+	const void		*lock;
+	const char		*name;
+	volatile long	acquisitions;
+	volatile long	contended;
+	volatile SInt64	spinCycles;
+};
+
+LockStats s_lockStats[LOCK_STATS_MAX];
+UInt32 s_numLockStats = 0;
+
+void __fastcall RegisterLockStats(const void *lock, const char *name)
+{
+	if (s_numLockStats < LOCK_STATS_MAX)
+		s_lockStats[s_numLockStats++] = {lock, name, 0, 0, 0};
 }
 
-__declspec(naked) void LightCS::Enter()
+__declspec(noinline) void __fastcall UpdateLockStats(const void *lock, UInt64 startTSC)
 {
-	__asm
+	for (UInt32 idx = 0; idx < s_numLockStats; idx++)
+		if (LockStats &stats = s_lockStats[idx]; stats.lock == lock)
+		{
+			_InterlockedIncrement(&stats.acquisitions);
+			if (startTSC)
+			{
+				_InterlockedIncrement(&stats.contended);
+				_InterlockedExchangeAdd64(&stats.spinCycles, __rdtsc() - startTSC);
+			}
+			break;
+		}
+}
+
+void DumpLockStats()
+{
+	for (UInt32 idx = 0; idx < s_numLockStats; idx++)
 	{
-		push	ebx
-		mov		ebx, ecx
-		call	GetCurrentThreadId
-		cmp		[ebx], eax
-		jz		incRefCnt
-		push	esi
-		push	edi
-		mov		esi, eax
-		mov		edi, Sleep
-		ALIGN 16
-	spinHead:
-		xor		eax, eax
-		lock cmpxchg [ebx], esi
-		jz		done
-		push	0
-		call	edi
-		jmp		spinHead
-		ALIGN 16
-	done:
-		mov		dword ptr [ebx+4], 1
-		pop		edi
-		pop		esi
-		pop		ebx
-		retn
-		ALIGN 16
-	incRefCnt:
-		inc		dword ptr [ebx+4]
-		pop		ebx
-		retn
+		LockStats &stats = s_lockStats[idx];
+		PrintDebug("> %s: %d acquisitions, %d contended, %I64d spin cycles", stats.name, stats.acquisitions, stats.contended, stats.spinCycles);
 	}
 }
 
+#define LOCK_STATS_START UInt64 startTSC = __rdtsc()
+#define LOCK_STATS_UPDATE(startTSC) UpdateLockStats(this, startTSC)
+#else
+#define LOCK_STATS_START
+#define LOCK_STATS_UPDATE(startTSC) ((void)0)
+#endif
+
+PrimitiveCS *PrimitiveCS::Enter()
+{
+	volatile long *pLock = (volatile long*)&selfPtr;
+	if (_InterlockedCompareExchange(pLock, (long)this, 0))
+	{
+		LOCK_STATS_START;
+		SpinBackoff backoff;
+		do
+		{
+			backoff();
+		}
+		while (*pLock || _InterlockedCompareExchange(pLock, (long)this, 0));
+		LOCK_STATS_UPDATE(startTSC);
+	}
+	else LOCK_STATS_UPDATE(0);
+	return this;
+}
+
+void LightCS::Enter()
+{
+	UInt32 threadID = GetCurrentThreadId();
+	if (owningThread == threadID)
+	{
+		enterCount++;
+		return;
+	}
+	volatile long *pLock = (volatile long*)&owningThread;
+	if (_InterlockedCompareExchange(pLock, threadID, 0))
+	{
+		LOCK_STATS_START;
+		SpinBackoff backoff;
+		do
+		{
+			backoff();
+		}
+		while (*pLock || _InterlockedCompareExchange(pLock, threadID, 0));
+		LOCK_STATS_UPDATE(startTSC);
+	}
+	else LOCK_STATS_UPDATE(0);
+	enterCount = 1;
+}
+
+void PrimitiveRWCS::EnterShared()
+{
+	long state = lockState;
+	if ((state & (kFlag_Writer | kFlag_WritePending)) || (_InterlockedCompareExchange(&lockState, state + 1, state) != state))
+	{
+		LOCK_STATS_START;
+		SpinBackoff backoff;
+		while (true)
+		{
+			state = lockState;
+			if (!(state & (kFlag_Writer | kFlag_WritePending)) && (_InterlockedCompareExchange(&lockState, state + 1, state) == state))
+				break;
+			backoff();
+		}
+		LOCK_STATS_UPDATE(startTSC);
+	}
+	else LOCK_STATS_UPDATE(0);
+}
+
+void PrimitiveRWCS::Enter()
+{
+	if (_InterlockedCompareExchange(&lockState, kFlag_Writer, 0))
+	{
+		LOCK_STATS_START;
+		SpinBackoff backoff;
+		while (true)
+		{
+			long state = lockState;
+			if (!(state & (kFlag_Writer | kMask_Readers)))
+			{
+				//	Clears kFlag_WritePending as well; other waiting writers will set it again.
+				if (_InterlockedCompareExchange(&lockState, kFlag_Writer, state) == state)
+					break;
+			}
+			else if (!(state & kFlag_WritePending))
+				_InterlockedOr(&lockState, kFlag_WritePending);
+			backoff();
+		}
+		LOCK_STATS_UPDATE(startTSC);
+	}
+	else LOCK_STATS_UPDATE(0);
+}
+
 UInt32 s_CPUFeatures = 0;
 
 __declspec(naked) UInt32 GetCPUFeatures()
@@ -2399,6 +2497,37 @@ bool __fastcall FileExists(const char *filePath)
 	return (attr != INVALID_FILE_ATTRIBUTES) && !(attr & FILE_ATTRIBUTE_DIRECTORY);
 }
 
+//	Case-insensitive match against a pattern of literals, '?' and '*'. Like FindFirstFile, "*.*" matches any name.
+bool __fastcall MatchesWildcard(const char *str, const char *pattern)
+{
+	if (!StrCompareCS(pattern, "*.*"))
+		return true;
+	const char *starPtn = nullptr, *starStr = nullptr;
+	while (*str)
+	{
+		if (*pattern == '*')
+		{
+			starPtn = ++pattern;
+			starStr = str;
+		}
+		else if (*pattern && ((*pattern == '?') || (kLwrCaseConverter[(UInt8)*pattern] == kLwrCaseConverter[(UInt8)*str])))
+		{
+			pattern++;
+			str++;
+		}
+		else if (!starPtn)
+			return false;
+		else
+		{
+			pattern = starPtn;
+			str = ++starStr;
+		}
+	}
+	while (*pattern == '*')
+		pattern++;
+	return !*pattern;
+}
+
 FileStream::FileStream(const char *filePath)
 {
 	theFile = fopen(filePath, "rb");
@@ -2652,6 +2781,44 @@ __declspec(naked) LineIterator::LineIterator(const char *filePath, char *buffer)
 	}
 }
 
+MappedFile::MappedFile(const char *filePath) : data(nullptr), size(0), isView(false)
+{
+	HANDLE hFile = CreateFileA(filePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE)
+		return;
+	if (LARGE_INTEGER fileSize; GetFileSizeEx(hFile, &fileSize) && fileSize.LowPart && !fileSize.HighPart && (fileSize.LowPart < 0x40000000))
+	{
+		size = fileSize.LowPart;
+		if (UInt32 slack = (0x1000 - (size & 0xFFF)) & 0xFFF; slack >= 0x10)
+			if (HANDLE hMapping = CreateFileMappingA(hFile, nullptr, PAGE_WRITECOPY, 0, 0, nullptr))
+			{
+				data = (char*)MapViewOfFile(hMapping, FILE_MAP_COPY, 0, 0, 0);
+				CloseHandle(hMapping);
+				isView = data != nullptr;
+			}
+		if (!data)
+		{
+			data = (char*)malloc(size + 0x10);
+			DWORD numRead;
+			if (!ReadFile(hFile, data, size, &numRead, nullptr) || (numRead != size))
+			{
+				free(data);
+				data = nullptr;
+			}
+		}
+		if (data) data[size] = 0;
+	}
+	CloseHandle(hFile);
+}
+
+MappedFile::~MappedFile()
+{
+	if (!data) return;
+	if (isView)
+		UnmapViewOfFile(data);
+	else free(data);
+}
+
 __declspec(noinline) UInt32 __fastcall FileToBuffer(const char *filePath, char *buffer, UInt32 maxLen)
 {
 	if (FileStream srcFile(filePath); srcFile)
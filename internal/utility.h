@@ -88,30 +88,171 @@ template <typename T_Array> class ArrayUtils
 	static bool __vectorcall CompareGT(Data_Arg lhs, Data_Arg rhs) {return rhs < lhs;}
 
 	typedef bool (__vectorcall *SortComperator)(Data_Arg, Data_Arg);
-	static void QuickSort(T_Array &array, UInt32 l, UInt32 h, SortComperator comperator)
+
+	static void InsertionSort(T_Data *pBgn, T_Data *pEnd, SortComperator comperator)
 	{
-		UInt32 i = l;
-		for (UInt32 j = l + 1; j < h; j++)
-			if (!comperator(array[l], array[j]))
-				RawSwap<T_Data>(&array[++i], &array[j]);
-		RawSwap<T_Data>(&array[l], &array[i]);
-		if (l < i)
-			QuickSort(array, l, i, comperator);
-		if (++i < h)
-			QuickSort(array, i, h, comperator);
+		alignas(T_Data) UInt8 buffer[sizeof(T_Data)];
+		T_Data &item = *reinterpret_cast<T_Data*>(buffer);
+		for (T_Data *pCurr = pBgn + 1; pCurr < pEnd; pCurr++)
+		{
+			if (!comperator(*pCurr, pCurr[-1]))
+				continue;
+			memcpy((void*)buffer, (const void*)pCurr, sizeof(T_Data));
+			T_Data *pDest = pCurr;
+			do
+			{
+				memcpy((void*)pDest, (const void*)(pDest - 1), sizeof(T_Data));
+			}
+			while ((--pDest != pBgn) && comperator(item, pDest[-1]));
+			memcpy((void*)pDest, (const void*)buffer, sizeof(T_Data));
+		}
+	}
+
+	static void SiftDown(T_Data *pData, UInt32 root, UInt32 size, SortComperator comperator)
+	{
+		while (true)
+		{
+			UInt32 child = (root << 1) + 1;
+			if (child >= size)
+				break;
+			if (((child + 1) < size) && comperator(pData[child], pData[child + 1]))
+				child++;
+			if (!comperator(pData[root], pData[child]))
+				break;
+			RawSwap<T_Data>(&pData[root], &pData[child]);
+			root = child;
+		}
+	}
+
+	static void HeapSort(T_Data *pData, UInt32 size, SortComperator comperator)
+	{
+		for (UInt32 idx = size >> 1; idx; idx--)
+			SiftDown(pData, idx - 1, size, comperator);
+		while (size > 1)
+		{
+			RawSwap<T_Data>(pData, &pData[--size]);
+			SiftDown(pData, 0, size, comperator);
+		}
+	}
+
+	static void Sort3(T_Data *pA, T_Data *pB, T_Data *pC, SortComperator comperator)
+	{
+		if (comperator(*pB, *pA))
+			RawSwap<T_Data>(pA, pB);
+		if (comperator(*pC, *pB))
+		{
+			RawSwap<T_Data>(pB, pC);
+			if (comperator(*pB, *pA))
+				RawSwap<T_Data>(pA, pB);
+		}
+	}
+
+	//	Partitions [pBgn, pEnd) around the pivot at pBgn, elements equal to the pivot going right.
+	//	Requires an element not less than the pivot at pEnd - 1 (guaranteed by the median-of-3).
+	static T_Data *PartitionRight(T_Data *pBgn, T_Data *pEnd, SortComperator comperator)
+	{
+		alignas(T_Data) UInt8 buffer[sizeof(T_Data)];
+		memcpy((void*)buffer, (const void*)pBgn, sizeof(T_Data));
+		T_Data &pivot = *reinterpret_cast<T_Data*>(buffer);
+		T_Data *pFirst = pBgn, *pLast = pEnd;
+		while (comperator(*++pFirst, pivot));
+		if ((pFirst - 1) == pBgn)
+			while ((pFirst < pLast) && !comperator(*--pLast, pivot));
+		else while (!comperator(*--pLast, pivot));
+		while (pFirst < pLast)
+		{
+			RawSwap<T_Data>(pFirst, pLast);
+			while (comperator(*++pFirst, pivot));
+			while (!comperator(*--pLast, pivot));
+		}
+		T_Data *pPivot = pFirst - 1;
+		memcpy((void*)pBgn, (const void*)pPivot, sizeof(T_Data));
+		memcpy((void*)pPivot, (const void*)buffer, sizeof(T_Data));
+		return pPivot;
+	}
+
+	//	Same, but elements equal to the pivot go left. Used when the pivot equals the preceding element,
+	//	so that runs of equal keys are consumed in one pass instead of degrading to O(n^2).
+	static T_Data *PartitionLeft(T_Data *pBgn, T_Data *pEnd, SortComperator comperator)
+	{
+		alignas(T_Data) UInt8 buffer[sizeof(T_Data)];
+		memcpy((void*)buffer, (const void*)pBgn, sizeof(T_Data));
+		T_Data &pivot = *reinterpret_cast<T_Data*>(buffer);
+		T_Data *pFirst = pBgn, *pLast = pEnd;
+		while (comperator(pivot, *--pLast));
+		if ((pLast + 1) == pEnd)
+			while ((pFirst < pLast) && !comperator(pivot, *++pFirst));
+		else while (!comperator(pivot, *++pFirst));
+		while (pFirst < pLast)
+		{
+			RawSwap<T_Data>(pFirst, pLast);
+			while (comperator(pivot, *--pLast));
+			while (!comperator(pivot, *++pFirst));
+		}
+		memcpy((void*)pBgn, (const void*)pLast, sizeof(T_Data));
+		memcpy((void*)pLast, (const void*)buffer, sizeof(T_Data));
+		return pLast;
+	}
+
+	//	Pattern-defeating introsort: median-of-3 pivots, insertion sort for small ranges, equal-key runs
+	//	skipped via PartitionLeft, and heapsort once the depth limit is exhausted.
+	//	Recurses into the smaller side only, so stack depth stays O(log n).
+	static void IntroSort(T_Data *pBgn, T_Data *pEnd, UInt32 depthLimit, SortComperator comperator, bool leftmost)
+	{
+		while (true)
+		{
+			UInt32 size = pEnd - pBgn;
+			if (size <= 0x10)
+			{
+				InsertionSort(pBgn, pEnd, comperator);
+				return;
+			}
+			if (!depthLimit--)
+			{
+				HeapSort(pBgn, size, comperator);
+				return;
+			}
+			T_Data *pMid = pBgn + (size >> 1);
+			Sort3(pBgn, pMid, pEnd - 1, comperator);
+			RawSwap<T_Data>(pBgn, pMid);
+			if (!leftmost && !comperator(pBgn[-1], *pBgn))
+			{
+				pBgn = PartitionLeft(pBgn, pEnd, comperator) + 1;
+				continue;
+			}
+			T_Data *pPivot = PartitionRight(pBgn, pEnd, comperator);
+			if ((pPivot - pBgn) < (pEnd - pPivot))
+			{
+				IntroSort(pBgn, pPivot, depthLimit, comperator, leftmost);
+				pBgn = pPivot + 1;
+				leftmost = false;
+			}
+			else
+			{
+				IntroSort(pPivot + 1, pEnd, depthLimit, comperator, false);
+				pEnd = pPivot;
+			}
+		}
+	}
+
+	static void QuickSort(T_Array &array, SortComperator comperator)
+	{
+		T_Data *pData = &array[0];
+		UInt32 size = array.Size();
+		IntroSort(pData, pData + size, std::bit_width(size) << 1, comperator, true);
 	}
 	
 public:
 	static void Sort(T_Array &array, bool descending = false)
 	{
 		if (array.Size() > 1)
-			QuickSort(array, 0, array.Size(), descending ? CompareGT : CompareLT);
+			QuickSort(array, descending ? CompareGT : CompareLT);
 	}
 
 	static void Sort(T_Array &array, SortComperator comperator)
 	{
 		if (array.Size() > 1)
-			QuickSort(array, 0, array.Size(), comperator);
+			QuickSort(array, comperator);
 	}
 
 	__declspec(noinline) static UInt32 InsertSorted(T_Array &array, Data_Val item, SortComperator comperator)
@@ -631,6 +772,8 @@ public:
 
 bool __fastcall FileExists(const char *filePath);
 
+bool __fastcall MatchesWildcard(const char *str, const char *pattern);
+
 class FileStream
 {
 	FILE		*theFile;
@@ -706,6 +849,23 @@ public:
 	}
 };
 
+//	Private, writable and null-terminated copy of a file's contents, memory-mapped copy-on-write when the last
+//	page leaves enough slack for the terminator and 16-byte SSE over-reads; otherwise read into the heap.
+class MappedFile
+{
+	char		*data;
+	UInt32		size;
+	bool		isView;
+
+public:
+	MappedFile(const char *filePath);
+	~MappedFile();
+
+	explicit operator bool() const {return data != nullptr;}
+	char *Data() const {return data;}
+	UInt32 Size() const {return size;}
+};
+
 class DirectoryIterator
 {
 	HANDLE				handle;
@@ -1452,6 +1452,12 @@ bool NVSEPlugin_Load(const NVSEInterface *nvse)
 	REG_CMD(UpdateNifBlock);
 	REG_CMD(UpdatePlayerScopeModel);
 
+	REG_CMD_ARR(AuxiliaryVariableGetMulti);
+	REG_CMD(AuxiliaryVariableSetMulti);
+	REG_CMD_ARR(AuxiliaryVariableGetForOwners);
+	REG_CMD(AuxiliaryVariableSetForOwners);
+	REG_CMD_ARR(GetActorsInRadius);
+
 	//===========================================================
 
 	if (nvse->isEditor)
@@ -1532,6 +1538,16 @@ void NVSEMessageHandler(NVSEMessagingInterface::Message *nvseMsg)
 
 			s_CPUFeatures = GetCPUFeatures();
 
+#if JIP_DEBUG
+			RegisterLockStats(MemoryPool::GetLock(), "MemoryPool");
+			RegisterLockStats(&s_NiFixedStringsCS, "NiFixedStrings");
+			RegisterLockStats(&s_hookInfoCS, "HookInfo");
+			RegisterLockStats(&s_auxVarCS, "AuxVariables");
+			RegisterLockStats(&s_refMapCS, "RefMaps");
+			RegisterLockStats((void*)SCENE_LIGHTS_CS, "SceneLights");
+			RegisterLockStats((void*)EXTRA_DATA_CS, "ExtraData");
+#endif
+
 			InitContainers();
 			InitJIPHooks();
 			InitGamePatches();
@@ -1548,6 +1564,9 @@ void NVSEMessageHandler(NVSEMessagingInterface::Message *nvseMsg)
 		case NVSEMessagingInterface::kMessage_ExitGame:
 			JIPScriptRunner::RunScripts(JIPScriptRunner::kRunOn_ExitGame);
 			PrintLog("> JIP MemoryPool session total allocations: %d KB", MemoryPool::GetTotalAllocSize() >> 0xA);
+#if JIP_DEBUG
+			DumpLockStats();
+#endif
 			break;
 		case NVSEMessagingInterface::kMessage_ExitToMainMenu:
 			ProcessDataChangedFlags(kChangedFlag_All);
@@ -1574,6 +1593,7 @@ void NVSEMessageHandler(NVSEMessagingInterface::Message *nvseMsg)
 			DoPreLoadGameHousekeeping();
 			break;
 		case NVSEMessagingInterface::kMessage_PostLoadGame:
+			s_actorsGrid->isValid = false;
 			if (nvseMsg->fosLoaded)
 			{
 				DoLoadGameHousekeeping();
@@ -1592,6 +1612,8 @@ void NVSEMessageHandler(NVSEMessagingInterface::Message *nvseMsg)
 			break;
 		case NVSEMessagingInterface::kMessage_NewGame:
 			s_serializedVars.Reset();
+			s_strRefs->Clear();
+			InvalidateFormListIndexes();
 			RestoreJIPFormFlags();
 			JIPScriptRunner::RunScripts(JIPScriptRunner::kRunOn_NewGame, JIPScriptRunner::kRunOn_LoadOrNewGame);
 			break;
@@ -1608,6 +1630,7 @@ void NVSEMessageHandler(NVSEMessagingInterface::Message *nvseMsg)
 			break;
 		case NVSEMessagingInterface::kMessage_MainGameLoop:
 		{
+			s_actorsGrid->isValid = false;
 			if (!s_mainLoopCallbacks->Empty())
 				CycleMainLoopCallbacks(*s_mainLoopCallbacks);
 			if (s_LNEventFlags)
@@ -1,148 +1,237 @@
 #include "nvse/GameData.h"
 #include "internal/jip_core.h"
 
-__declspec(naked) ModInfo* __fastcall DataHandler::LookupModByName(const char *modName) const
+//	Open-addressed table of load-order indexes keyed by name hash, built on first use after the mods are loaded.
+#define MOD_NAMES_TABLE_SIZE 0x200
+UInt8 s_modNamesTable[MOD_NAMES_TABLE_SIZE];
+volatile UInt32 s_modNamesTableCount = 0;
+PrimitiveCS s_modNamesTableCS;
+
+ModInfo* __fastcall DataHandler::LookupModByName(const char *modName) const
 {
-	_asm
+	UInt32 modCount = modList.loadedModCount;
+	if (!modCount) return nullptr;
+	if (s_modNamesTableCount != modCount)
 	{
-		push	ebx
-		lea		ebx, [ecx+0x21C]
-		mov		ecx, edx
-		call	StrHashCI
-		mov		ecx, eax
-		mov		edx, [ebx-4]
-		ALIGN 16
-	iterHead:
-		mov		eax, [ebx]
-		cmp		[eax+0x120], ecx
-		jz		done
-		add		ebx, 4
-		dec		edx
-		jnz		iterHead
-		xor		eax, eax
-	done:
-		pop		ebx
-		retn
+		ScopedPrimitiveCS cs(&s_modNamesTableCS);
+		if (s_modNamesTableCount != modCount)
+		{
+			memset(s_modNamesTable, 0xFF, sizeof(s_modNamesTable));
+			for (UInt32 modIdx = 0; modIdx < modCount; modIdx++)
+			{
+				UInt32 index = modList.loadedMods[modIdx]->nameHash;
+				while (s_modNamesTable[index &= (MOD_NAMES_TABLE_SIZE - 1)] != 0xFF)
+					index++;
+				s_modNamesTable[index] = modIdx;
+			}
+			_WriteBarrier();
+			s_modNamesTableCount = modCount;
+		}
+	}
+	UInt32 hashVal = StrHashCI(modName);
+	for (UInt32 index = hashVal; ; index++)
+	{
+		UInt8 modIdx = s_modNamesTable[index & (MOD_NAMES_TABLE_SIZE - 1)];
+		if (modIdx == 0xFF)
+			return nullptr;
+		ModInfo *modInfo = modList.loadedMods[modIdx];
+		if ((modInfo->nameHash == hashVal) && !StrCompareCI(modInfo->name, modName))
+			return modInfo;
 	}
 }
 
 char kDecompilePath[0x100] = "DecompiledScripts (JIP)\\";
 
+//	Forms are decompiled one at a time on the calling thread, since the decompiler is not known to be thread-safe.
+//	Each output goes through one of a ring of 64 KB file write buffers (normally the whole output), and a few worker
+//	threads only flush and close the finished files - the costly part for mods with thousands of small files.
+#define DECOMPILE_WORKERS_MAX 8
+#define DECOMPILE_SLOTS 0x10
+#define DECOMPILE_BUFFER_SIZE 0x10000
+
+struct DecompileJob
+{
+	TESForm		*form;
+	UInt32		type;
+	char		filePath[MAX_PATH];
+};
+
+struct DecompileSlot
+{
+	FileStream		outFile;
+	char			*filePath;
+	HANDLE			freeEvent;
+	bool			isEmpty;
+};
+
+struct DecompileJobs
+{
+	Vector<DecompileJob>	jobs;
+	DecompileSlot			slots[DECOMPILE_SLOTS];
+	HANDLE					readySem;
+	volatile long			nextClose;
+
+	DecompileJobs() : jobs(0x100), readySem(nullptr), nextClose(0) {}
+};
+
+size_t __fastcall DecompileJobForm(DecompileJob &job, FILE *outFile)
+{
+	switch (job.type)
+	{
+		case 0: return DecompileToBuffer((Script*)job.form, outFile, nullptr);
+		case 1: return ((TESQuest*)job.form)->DecompileResultScripts(outFile, nullptr);
+		case 2: return ((TESPackage*)job.form)->DecompileResultScripts(outFile, nullptr);
+		case 3: return ((TESTopicInfo*)job.form)->DecompileResultScripts(outFile, nullptr);
+		default: return ((BGSTerminal*)job.form)->DecompileResultScripts(outFile, nullptr);
+	}
+}
+
+void __fastcall CloseDecompileSlot(DecompileSlot &slot)
+{
+	if (!slot.outFile) return;
+	slot.outFile.Close();
+	if (slot.isEmpty)
+		remove(slot.filePath);
+}
+
+//	Slots are handed over in job order; an index past the last job tells the worker to exit.
+DWORD WINAPI DecompileCloseWorker(LPVOID param)
+{
+	DecompileJobs *decompile = (DecompileJobs*)param;
+	while (true)
+	{
+		WaitForSingleObject(decompile->readySem, INFINITE);
+		UInt32 index = _InterlockedIncrement(&decompile->nextClose) - 1;
+		if (index >= decompile->jobs.Size())
+			break;
+		DecompileSlot &slot = decompile->slots[index % DECOMPILE_SLOTS];
+		CloseDecompileSlot(slot);
+		SetEvent(slot.freeEvent);
+	}
+	return 0;
+}
+
 void DataHandler::DecompileModScripts(UInt8 modIdx, UInt8 typeMask)
 {
-	FileStream outFile;
-	char *wBuffer = GetStrArgBuffer(), *mainEnd = StrCopy(kDecompilePath + 24, GetNthModName(modIdx)), *typeEnd;
+	DecompileJobs decompile;
+	char *mainEnd = StrCopy(kDecompilePath + 24, GetNthModName(modIdx));
 	*mainEnd++ = '\\';
 
+	auto AddJob = [&](TESForm *form, UInt32 type) -> char*
+	{
+		DecompileJob *job = decompile.jobs.Append();
+		job->form = form;
+		job->type = type;
+		return StrCopy(job->filePath, kDecompilePath);
+	};
+	auto AddNamedJob = [&](TESForm *form, UInt32 type)
+	{
+		char *fileEnd = StrCopy(AddJob(form, type), form->GetEditorID());
+		*(UInt32*)fileEnd = 'txt.';
+		fileEnd[4] = 0;
+	};
+
 	if (typeMask & 1)
 	{
-		typeEnd = StrCopy(mainEnd, "Script\\");
+		StrCopy(mainEnd, "Script\\");
 		auto scrIter = scriptList.Head();
 		do
 		{
 			if (auto pScript = scrIter->data; pScript && pScript->info.dataLength && (pScript->GetOverridingModIdx() == modIdx))
-			{
-				char *fileEnd = StrCopy(typeEnd, pScript->GetEditorID());
-				*(UInt32*)fileEnd = 'txt.';
-				fileEnd[4] = 0;
-				if (outFile.OpenWriteEx(kDecompilePath, wBuffer, 0x10000))
-				{
-					size_t numWritten = DecompileToBuffer(pScript, outFile, nullptr);
-					outFile.Close();
-					if (!numWritten)
-						remove(kDecompilePath);
-				}
-			}
+				AddNamedJob(pScript, 0);
 		}
 		while (scrIter = scrIter->next);
 	}
 
 	if (typeMask & 2)
 	{
-		typeEnd = StrCopy(mainEnd, "Quest\\");
+		StrCopy(mainEnd, "Quest\\");
 		auto qstIter = questList.Head();
 		do
 		{
 			if (auto pQuest = qstIter->data; pQuest && (pQuest->GetOverridingModIdx() == modIdx))
-			{
-				char *fileEnd = StrCopy(typeEnd, pQuest->GetEditorID());
-				*(UInt32*)fileEnd = 'txt.';
-				fileEnd[4] = 0;
-				if (outFile.OpenWriteEx(kDecompilePath, wBuffer, 0x10000))
-				{
-					size_t numWritten = pQuest->DecompileResultScripts(outFile, nullptr);
-					outFile.Close();
-					if (!numWritten)
-						remove(kDecompilePath);
-				}
-			}
+				AddNamedJob(pQuest, 1);
 		}
 		while (qstIter = qstIter->next);
 	}
 
 	if (typeMask & 4)
 	{
-		typeEnd = StrCopy(mainEnd, "Package\\");
+		StrCopy(mainEnd, "Package\\");
 		auto pkgIter = packageList.Head();
 		do
 		{
 			if (auto pPackage = pkgIter->data; pPackage && (pPackage->GetOverridingModIdx() == modIdx))
-			{
-				char *fileEnd = StrCopy(typeEnd, pPackage->GetEditorID());
-				*(UInt32*)fileEnd = 'txt.';
-				fileEnd[4] = 0;
-				if (outFile.OpenWriteEx(kDecompilePath, wBuffer, 0x10000))
-				{
-					size_t numWritten = pPackage->DecompileResultScripts(outFile, nullptr);
-					outFile.Close();
-					if (!numWritten)
-						remove(kDecompilePath);
-				}
-			}
+				AddNamedJob(pPackage, 2);
 		}
 		while (pkgIter = pkgIter->next);
 	}
 
 	if (typeMask & 8)
 	{
-		typeEnd = StrCopy(mainEnd, "Dialogue\\");
+		StrCopy(mainEnd, "Dialogue\\");
 		auto dlgIter = topicInfoList.Head();
 		do
 		{
 			if (auto pTopic = dlgIter->data; pTopic && (pTopic->GetOverridingModIdx() == modIdx) && pTopic->parentTopic)
-			{
-				sprintf_s(typeEnd, 0x80, "%06X [%s].txt", pTopic->refID & 0xFFFFFF, pTopic->parentTopic->editorIDstr.CStr());
-				if (outFile.OpenWriteEx(kDecompilePath, wBuffer, 0x10000))
-				{
-					size_t numWritten = pTopic->DecompileResultScripts(outFile, nullptr);
-					outFile.Close();
-					if (!numWritten)
-						remove(kDecompilePath);
-				}
-			}
+				sprintf_s(AddJob(pTopic, 3), 0x80, "%06X [%s].txt", pTopic->refID & 0xFFFFFF, pTopic->parentTopic->editorIDstr.CStr());
 		}
 		while (dlgIter = dlgIter->next);
 	}
 
 	if (typeMask & 0x10)
 	{
-		typeEnd = StrCopy(mainEnd, "Terminal\\");
+		StrCopy(mainEnd, "Terminal\\");
 		for (auto bndIter = boundObjectList->first; bndIter; bndIter = bndIter->next)
 			if (IS_ID(bndIter, BGSTerminal) && (bndIter->GetOverridingModIdx() == modIdx))
 				if (auto terminal = (BGSTerminal*)bndIter; !terminal->menuEntries.Empty())
-				{
-					char *fileEnd = StrCopy(typeEnd, terminal->GetEditorID());
-					*(UInt32*)fileEnd = 'txt.';
-					fileEnd[4] = 0;
-					if (outFile.OpenWriteEx(kDecompilePath, wBuffer, 0x10000))
-					{
-						size_t numWritten = terminal->DecompileResultScripts(outFile, nullptr);
-						outFile.Close();
-						if (!numWritten)
-							remove(kDecompilePath);
-					}
-				}
+					AddNamedJob(terminal, 4);
+	}
+
+	UInt32 numJobs = decompile.jobs.Size();
+	if (!numJobs) return;
+	SYSTEM_INFO sysInfo;
+	GetSystemInfo(&sysInfo);
+	UInt32 numWorkers = GetMin(GetMin((UInt32)sysInfo.dwNumberOfProcessors, (UInt32)DECOMPILE_WORKERS_MAX), numJobs);
+	HANDLE workers[DECOMPILE_WORKERS_MAX];
+	UInt32 numStarted = 0, numEvents = 0;
+	if (decompile.readySem = CreateSemaphoreA(nullptr, 0, numJobs + numWorkers, nullptr))
+	{
+		for (; numEvents < DECOMPILE_SLOTS; numEvents++)
+			if (!(decompile.slots[numEvents].freeEvent = CreateEventA(nullptr, FALSE, TRUE, nullptr)))
+				break;
+		if (numEvents == DECOMPILE_SLOTS)
+			for (; numStarted < numWorkers; numStarted++)
+				if (!(workers[numStarted] = CreateThread(nullptr, 0, DecompileCloseWorker, &decompile, 0, nullptr)))
+					break;
+	}
+	char *wBuffers = (char*)malloc(DECOMPILE_BUFFER_SIZE * DECOMPILE_SLOTS);
+	for (UInt32 index = 0; index < numJobs; index++)
+	{
+		DecompileJob &job = decompile.jobs[index];
+		UInt32 slotIdx = index % DECOMPILE_SLOTS;
+		DecompileSlot &slot = decompile.slots[slotIdx];
+		if (numStarted)
+			WaitForSingleObject(slot.freeEvent, INFINITE);
+		slot.filePath = job.filePath;
+		if (slot.outFile.OpenWriteEx(job.filePath, wBuffers + (slotIdx * DECOMPILE_BUFFER_SIZE), DECOMPILE_BUFFER_SIZE))
+			slot.isEmpty = !DecompileJobForm(job, slot.outFile);
+		if (numStarted)
+			ReleaseSemaphore(decompile.readySem, 1, nullptr);
+		else CloseDecompileSlot(slot);
+	}
+	if (numStarted)
+	{
+		ReleaseSemaphore(decompile.readySem, numStarted, nullptr);
+		WaitForMultipleObjects(numStarted, workers, TRUE, INFINITE);
+		for (UInt32 index = 0; index < numStarted; index++)
+			CloseHandle(workers[index]);
 	}
+	free(wBuffers);
+	while (numEvents)
+		CloseHandle(decompile.slots[--numEvents].freeEvent);
+	if (decompile.readySem)
+		CloseHandle(decompile.readySem);
 }
 
 void Sky::RefreshMoon()
@@ -206,6 +206,7 @@ public:
 	NiTexture** __fastcall GetTexturePtr(const char *blockName) const;
 	void SwapTexture(const char *blockName, const char *filePath, UInt32 texIdx);
 	bool SetLinkedRef(TESObjectREFR *linkObj, UInt8 modIdx = 0xFF);
+	void RevertLinkedRef(UInt32 defaultID);
 	bool ValidForHooks() const;
 	NiNode *GetNiNode() const;
 	NiAVObject* __fastcall GetNiBlock(const char *blockName) const;
@@ -66,8 +66,61 @@ public:
 	}
 };
 
+//	Scripts with long variable lists get a name index, built on first lookup. The list's head item and varCount
+//	are recorded with it; the game rebuilding the list changes both, and the index is then rebuilt. Keys are
+//	name hashes only, so hits are confirmed by name and colliding names fall back to the list walk. The index
+//	is released with its script (ReleaseVariableIndex).
+#define SCRIPT_VAR_INDEX_MIN 0x10
+
+struct ScriptVarIndex
+{
+	VariableInfo								*headVar;
+	UInt32										varCount;
+	bool										hasCollisions;
+	UnorderedMap<const char*, VariableInfo*>	vars;
+
+	ScriptVarIndex() : headVar(nullptr), varCount(0), hasCollisions(false) {}
+
+	void Add(VariableInfo *varInfo)
+	{
+		VariableInfo **outVar;
+		if (vars.InsertKey(varInfo->name.m_data, &outVar))
+			*outVar = varInfo;
+		else hasCollisions = true;
+	}
+};
+
+TempObject<UnorderedMap<const Script*, ScriptVarIndex>> s_scriptVarIndexes;
+PrimitiveCS s_scriptVarIndexCS;
+
 VariableInfo *Script::GetVariableByName(const char *varName) const
 {
+	if (info.varCount >= SCRIPT_VAR_INDEX_MIN)
+	{
+		ScopedPrimitiveCS cs(&s_scriptVarIndexCS);
+		ScriptVarIndex &varIndex = s_scriptVarIndexes()[this];
+		if ((varIndex.headVar != varList.m_listHead.data) || (varIndex.varCount != info.varCount))
+		{
+			varIndex.headVar = varList.m_listHead.data;
+			varIndex.varCount = info.varCount;
+			varIndex.hasCollisions = false;
+			varIndex.vars.Clear();
+			auto varIter = varList.Head();
+			do
+			{
+				if (VariableInfo *varInfo = varIter->data; varInfo && varInfo->name.m_data)
+					varIndex.Add(varInfo);
+			}
+			while (varIter = varIter->next);
+		}
+		if (VariableInfo *varInfo = varIndex.vars.Get(varName))
+		{
+			if (!StrCompareCI(varInfo->name.m_data, varName))
+				return varInfo;
+		}
+		else if (!varIndex.hasCollisions)
+			return NULL;
+	}
 	auto varIter = varList.Head();
 	do
 	{
@@ -78,6 +131,25 @@ VariableInfo *Script::GetVariableByName(const char *varName) const
 	return NULL;
 }
 
+void Script::AddVariableInfo(VariableInfo *varInfo)
+{
+	varInfo->idx = ++info.varCount;
+	varList.Prepend(varInfo);
+	ScopedPrimitiveCS cs(&s_scriptVarIndexCS);
+	if (ScriptVarIndex *varIndex = s_scriptVarIndexes->GetPtr(this); varIndex && (varIndex->varCount == (info.varCount - 1)))
+	{
+		varIndex->headVar = varInfo;
+		varIndex->varCount = info.varCount;
+		varIndex->Add(varInfo);
+	}
+}
+
+void Script::ReleaseVariableIndex() const
+{
+	ScopedPrimitiveCS cs(&s_scriptVarIndexCS);
+	s_scriptVarIndexes->Erase(this);
+}
+
 Script::RefVariable	*Script::GetVariable(UInt32 reqIdx) const
 {
 	UInt32 idx = 1;	// yes, really starts at 1
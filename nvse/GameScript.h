@@ -70,6 +70,8 @@ public:
 	bool IsMagicScript() const {return info.isEffectScr;}
 
 	VariableInfo *GetVariableByName(const char *varName) const;
+	void AddVariableInfo(VariableInfo *varInfo);
+	void ReleaseVariableIndex() const;
 	ScriptVar *AddVariable(char *varName, ScriptLocals *eventList, UInt32 ownerID, UInt8 modIdx);
 	UInt32 GetDataLength() const;
 
@@ -82,6 +84,7 @@ public:
 	}
 	__forceinline void Destructor()
 	{
+		ReleaseVariableIndex();
 		ThisCall(0x5AA1A0, this);
 	}
 
@@ -596,6 +596,13 @@ constexpr ParamInfo kParams_OneInt_OneOptionalForm[] =
 	{kParamType_AnyForm, 1}
 };
 
+constexpr ParamInfo kParams_OneInt_OneOptionalInt_OneOptionalForm[] =
+{
+	{kParamType_Integer},
+	{kParamType_Integer, 1},
+	{kParamType_AnyForm, 1}
+};
+
 constexpr ParamInfo kParams_OneString_OneInt_OneOptionalForm[] =
 {
 	{kParamType_String},